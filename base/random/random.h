@@ -57,9 +57,9 @@
 #ifndef MERSENNETWISTER_H
 #define MERSENNETWISTER_H
 
-// Not thread safe (unless auto-initialization is avoided and each thread has
-// its own MTRand object)
+// Not thread safe (unless each thread has its own MTRand object)
 
+#include <atomic>
 #include <iostream>
 #include <limits.h>
 #include <stdio.h>
@@ -369,7 +369,9 @@ inline MTRand::uint32 MTRand::hash(time_t t, clock_t c) {
     // Better than uint32(x) in case x is floating point in [0,1]
     // Based on code by Lawrence Kirby (fred@genesis.demon.co.uk)
 
-    static uint32 differ = 0;  // guarantee time-based seeds will change
+    // guarantee time-based seeds will change (also when generators are
+    // seeded concurrently by several threads)
+    static std::atomic<uint32> differ(0);
 
     uint32 h1 = 0;
     unsigned char *p = (unsigned char *) &t;
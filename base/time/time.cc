@@ -154,6 +154,19 @@ unsigned int secondsElapsed(CTimer *t)
     return (unsigned int)(ms / 1000);
 }
 
+/**
+ * fractionalSecondsElapsed ()
+ * The function returns the number of seconds elapsed including the fraction
+ * of the last second
+ */
+double fractionalSecondsElapsed(CTimer *t)
+{
+    ULARGE_INTEGER i;
+    i.HighPart = t->time.dwHighDateTime;
+    i.LowPart = t->time.dwLowDateTime;
+    return i.QuadPart / 1e7;
+}
+
 
 #else
 
@@ -233,5 +246,10 @@ unsigned int secondsElapsed(CTimer *t)
     return t->time.tv_sec;
 }
 
+double fractionalSecondsElapsed(CTimer *t)
+{
+    return t->time.tv_sec + t->time.tv_usec / 1e6;
+}
+
 #endif
 
@@ -98,6 +98,13 @@ CString printTimer(CTimer *t);
  */
 unsigned int secondsElapsed(CTimer *t);
 
+/**
+ * fractionalSecondsElapsed ()
+ * The function returns the number of seconds elapsed including the fraction
+ * of the last second
+ */
+double fractionalSecondsElapsed(CTimer *t);
+
 
 #endif
 
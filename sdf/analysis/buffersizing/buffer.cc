@@ -38,6 +38,7 @@
 #include "buffer.h"
 #include "../../base/algo/repetition_vector.h"
 #include "../throughput/throughput.h"
+#include <limits>
 
 namespace SDF
 {
@@ -45,14 +46,51 @@ namespace SDF
      * Bounds on the search space
      *****************************************************************************/
 
+    /**
+     * MinimalChannelSizes
+     * Lower bounds on the size and the step size of all channels of a graph
+     * (cached on the graph).
+     */
+    typedef struct _MinimalChannelSizes
+    {
+        vector<TBufSize> sz;
+        vector<TBufSize> step;
+    } MinimalChannelSizes;
+
+    typedef SDFgraphCache::Value<MinimalChannelSizes> CachedMinimalChannelSizes;
+
     /**
      * initBoundsSearchSpace ()
      * Compute bounds on the trade-off space that must be explored.
      */
     void SDFstateSpaceBufferAnalysis::initBoundsSearchSpace(TimedSDFgraph *graph)
     {
-        initMinimalChannelSzStep(graph);
-        initMinimalChannelSz(graph);
+        SDFgraphCache::Artifact *cached;
+
+        cached = graph->getCache().lookup(
+                     SDFgraphCache::MinimalChannelSizesArtifact);
+        if (cached != NULL)
+        {
+            MinimalChannelSizes &m = ((CachedMinimalChannelSizes *)cached)->value;
+
+            minSzStep = new TBufSize [graph->nrChannels()];
+            std::copy(m.step.begin(), m.step.end(), minSzStep);
+            minSz = new TBufSize [graph->nrChannels()];
+            std::copy(m.sz.begin(), m.sz.end(), minSz);
+        }
+        else
+        {
+            MinimalChannelSizes m;
+
+            initMinimalChannelSzStep(graph);
+            initMinimalChannelSz(graph);
+
+            m.step.assign(minSzStep, minSzStep + graph->nrChannels());
+            m.sz.assign(minSz, minSz + graph->nrChannels());
+            graph->getCache().store(SDFgraphCache::MinimalChannelSizesArtifact,
+                                    new CachedMinimalChannelSizes(m));
+        }
+
         initLbDistributionSz(graph);
         initMaxThroughput(graph);
     }
@@ -194,6 +232,34 @@ namespace SDF
         glbClk = 0;
     }
 
+    /**
+     * pack ()
+     * The function stores the words which identify the state in words. Two
+     * states are equal when their words are equal.
+     */
+    void SDFstateSpaceBufferAnalysis::TransitionSystem::State::pack(
+        vector<unsigned long long> &words) const
+    {
+        words.clear();
+        words.push_back(glbClk);
+
+        for (uint i = 0; i < ch.size(); i++)
+        {
+            words.push_back(ch[i]);
+            words.push_back(sp[i]);
+        }
+
+        for (uint i = 0; i < actClk.size(); i++)
+        {
+            words.push_back(actClk[i].size());
+            for (auto iter = actClk[i].begin();
+                 iter != actClk[i].end(); iter++)
+            {
+                words.push_back(*iter);
+            }
+        }
+    }
+
     /**
      * operator== ()
      * The function compares to states and returns true if they are equal.
@@ -231,21 +297,13 @@ namespace SDF
     void SDFstateSpaceBufferAnalysis::TransitionSystem::initOutputActor()
     {
         RepetitionVector repVec;
-        int min = INT_MAX;
-        SDFactor *a = nullptr;
+        SDFactor *a;
 
         // Compute repetition vector
         repVec = computeRepetitionVector(g);
 
         // Select actor with lowest entry in repetition vector as output actor
-        for (auto iter = g->actorsBegin(); iter != g->actorsEnd(); iter++)
-        {
-            if (repVec[(*iter)->getId()] < min)
-            {
-                a = *iter;
-                min = repVec[a->getId()];
-            }
-        }
+        a = selectOutputActor(g);
 
         // Set output actor and its repetition vector count
         outputActor = a;
@@ -254,36 +312,18 @@ namespace SDF
 
     /**
      * storeState ()
-     * The function stores the state s on whenever s is not already in the
-     * list of storedStates. When s is stored, the function returns true. When the
-     * state s is already in the list, the state s is not stored. The function
-     * returns false. The function always sets the pos variable to the position
-     * where the state s is in the list.
+     * The function stores the state s whenever s is not already in the set of
+     * storedStates. When s is stored, the function returns true. When the
+     * state s is already stored, the function returns false. The function
+     * always sets the pos variable to the position of the state s in the
+     * stored states.
      */
     bool SDFstateSpaceBufferAnalysis::TransitionSystem::storeState(State &s,
-            StatesIter &pos)
+            SDFstateSpaceStateStore::Index &pos)
     {
-        // Find state in the list of stored states
-        for (auto iter = storedStates.begin();
-             iter != storedStates.end(); iter++)
-        {
-            State &x = *iter;
-
-            // State s at position iter in the list?
-            if (x == s)
-            {
-                pos = iter;
-                return false;
-            }
-        }
-
-        // State not found, store it at the end of the list
-        storedStates.push_back(s);
+        s.pack(packedState);
 
-        // Added state to the end of the list
-        pos = storedStates.end();
-
-        return true;
+        return storedStates.store(packedState, s.glbClk, pos);
     }
 
     /**
@@ -292,22 +332,21 @@ namespace SDF
      * value is equal to the average number of firings of an actor per time unit.
      */
     TDtime SDFstateSpaceBufferAnalysis::TransitionSystem::computeThroughput(
-        const StatesIter cycleIter)
+        const SDFstateSpaceStateStore::Index cycleStart)
     {
         int nr_fire = 0;
         TDtime time = 0;
 
         // Check all state from stack till cycle complete
-        for (StatesIter iter = cycleIter; iter != storedStates.end(); iter++)
+        for (SDFstateSpaceStateStore::Index i = cycleStart;
+             i < storedStates.size(); i++)
         {
-            State &s = *iter;
-
             // Number of states in cycle is equal to number of iterations
             // in the period
             nr_fire++;
 
             // Time between previous state
-            time += s.glbClk;
+            time += storedStates.getClk(i);
         }
 
         return (TDtime)(nr_fire) / (time);
@@ -492,27 +531,12 @@ namespace SDF
             {
                 CONSUME_SP(c->getId(), p->getRate());
             }
+
+            markChannelChanged(c);
         }
 
         // Add actor firing to the list of active firings of this actor
-        currentState.actClk[a->getId()].push_back(a->getExecutionTime());
-    }
-
-    /**
-     * actorReadyToEnd ()
-     * The function returns true when the actor is ready to end its firing. Else
-     * the function returns false.
-     */
-    bool SDFstateSpaceBufferAnalysis::TransitionSystem::actorReadyToEnd(SDFactor *a)
-    {
-        if (currentState.actClk[a->getId()].empty())
-            return false;
-
-        // First actor firing in sorted list has execution time left?
-        if (currentState.actClk[a->getId()].front() != 0)
-            return false;
-
-        return true;
+        events.startFiring(a, a->getExecutionTime());
     }
 
     /**
@@ -531,61 +555,55 @@ namespace SDF
             if (p->getType() == SDFport::Out)
             {
                 PRODUCE(c->getId(), p->getRate());
+
+                // Destination actor may have become enabled
+                events.markCandidate(c->getDstActor());
             }
             else
             {
                 PRODUCE_SP(c->getId(), p->getRate());
+
+                // Source actor may have become enabled
+                events.markCandidate(c->getSrcActor());
             }
+
+            markChannelChanged(c);
         }
 
         // Remove the firing from the list of active actor firings
-        currentState.actClk[a->getId()].pop_front();
+        events.endFiring(a);
     }
 
     /**
-     * clockStep ()
-     * The function progresses time till the first end of firing transition
-     * becomes enabled. The time step is returned. In case of deadlock, the
-     * time step is equal to UINT_MAX.
+     * markChannelChanged ()
+     * The function records that the tokens or space of channel c changed since
+     * the previous state was stored.
      */
-    SDFtime SDFstateSpaceBufferAnalysis::TransitionSystem::clockStep()
+    void SDFstateSpaceBufferAnalysis::TransitionSystem::markChannelChanged(
+        SDFchannel *c)
     {
-        SDFtime step = UINT_MAX;
-
-        // Find maximal time progress
-        for (uint a = 0; a < g->nrActors(); a++)
+        if (!channelChanged[c->getId()])
         {
-            if (!currentState.actClk[a].empty())
-            {
-                SDFtime actClk = currentState.actClk[a].front();
-
-                if (step > actClk)
-                    step = actClk;
-            }
+            channelChanged[c->getId()] = true;
+            changedChannels.push_back(c);
         }
+    }
 
-        // Still actors ready to end their firing?
-        if (step == 0)
-            return 0;
-
-        // Check for progress (i.e. no deadlock)
-        if (step == UINT_MAX)
-            return UINT_MAX;
-
-        // Lower remaining execution time actors
-        for (uint a = 0; a < g->nrActors(); a++)
+    /**
+     * storePreviousState ()
+     * The function copies the tokens and space of all channels which changed
+     * since the last call from the current state to the previous state.
+     */
+    void SDFstateSpaceBufferAnalysis::TransitionSystem::storePreviousState()
+    {
+        for (auto c : changedChannels)
         {
-            for (unsigned int & actFiringTime : currentState.actClk[a])
-            {
-                // Lower remaining execution time of the actor firing
-                actFiringTime -= step;
-            }
+            previousState.ch[c->getId()] = currentState.ch[c->getId()];
+            previousState.sp[c->getId()] = currentState.sp[c->getId()];
+            channelChanged[c->getId()] = false;
         }
 
-        // Advance the global clock
-        currentState.glbClk += step;
-
-        return step;
+        changedChannels.clear();
     }
 
     /**
@@ -662,7 +680,7 @@ namespace SDF
         {
             SDFactor *a = *iter;
 
-            while (actorReadyToEnd(a))
+            while (events.firingEnds(a))
             {
                 if (a->getId() == outputActor->getId())
                 {
@@ -682,11 +700,8 @@ namespace SDF
         while (true)
         {
             // Start actor firings
-            for (auto iter = g->actorsBegin();
-                 iter != g->actorsEnd(); iter++)
+            for (auto a : events.readyCandidates())
             {
-                auto *a = (TimedSDFactor *)(*iter);
-
                 // Ready to fire actor a?
                 while (actorReadyToFire(a))
                 {
@@ -694,33 +709,29 @@ namespace SDF
                     findCausalDependencies(a, abstractDepGraph);
 
                     // Fire actor a
-                    startActorFiring(a);
+                    startActorFiring((TimedSDFactor *)a);
                 }
             }
 
             // Clock step
-            clockStep();
+            currentState.glbClk += events.clockStep();
 
             // Store partial state to check for progress
-            for (uint i = 0; i < g->nrChannels(); i++)
-            {
-                previousState.ch[i] = currentState.ch[i];
-                previousState.sp[i] = currentState.sp[i];
-            }
+            storePreviousState();
 
             // Finish actor firings
-            for (auto iter = g->actorsBegin();
-                 iter != g->actorsEnd(); iter++)
+            for (auto a : events.actorsEndingNow())
             {
-                SDFactor *a = *iter;
-
-                while (actorReadyToEnd(a))
+                while (events.firingEnds(a))
                 {
                     if (outputActor->getId() == a->getId())
                     {
                         repCnt++;
                         if (repCnt == outputActorRepCnt)
                         {
+                            // Remaining execution times of active firings
+                            events.getRemainingTimes(currentState.actClk);
+
                             // Found periodic state
                             if (currentState == periodicState)
                             {
@@ -804,7 +815,7 @@ namespace SDF
     TDtime SDFstateSpaceBufferAnalysis::TransitionSystem::execSDFgraph(
         const TBufSize *sp, bool *dep)
     {
-        StatesIter recurrentState;
+        SDFstateSpaceStateStore::Index recurrentState;
         TTime clkStep;
         int repCnt = 0;
 
@@ -816,6 +827,9 @@ namespace SDF
         currentState.clear();
         previousState.init(g->nrActors(), g->nrChannels());
         previousState.clear();
+        changedChannels.clear();
+        channelChanged.assign(g->nrChannels(), false);
+        events.clear();
 
         // Initial tokens and space
         for (auto iter = g->channelsBegin();
@@ -832,31 +846,28 @@ namespace SDF
 
             CH(c->getId()) = c->getInitialTokens();
             SP(c->getId()) = sp[c->getId()] - c->getInitialTokens();
+            markChannelChanged(c);
         }
 
         // Fire the actors
         while (true)
         {
             // Store partial state to check for progress
-            for (uint i = 0; i < g->nrChannels(); i++)
-            {
-                previousState.ch[i] = currentState.ch[i];
-                previousState.sp[i] = currentState.sp[i];
-            }
+            storePreviousState();
 
             // Finish actor firings
-            for (auto iter = g->actorsBegin();
-                 iter != g->actorsEnd(); iter++)
+            for (auto a : events.actorsEndingNow())
             {
-                SDFactor *a = *iter;
-
-                while (actorReadyToEnd(a))
+                while (events.firingEnds(a))
                 {
                     if (outputActor->getId() == a->getId())
                     {
                         repCnt++;
                         if (repCnt == outputActorRepCnt)
                         {
+                            // Remaining execution times of active firings
+                            events.getRemainingTimes(currentState.actClk);
+
                             // Add state to hash of visited states
                             if (!storeState(currentState, recurrentState))
                             {
@@ -876,21 +887,18 @@ namespace SDF
             }
 
             // Start actor firings
-            for (auto iter = g->actorsBegin();
-                 iter != g->actorsEnd(); iter++)
+            for (auto a : events.readyCandidates())
             {
-                auto *a = (TimedSDFactor *)(*iter);
-
                 // Ready to fire actor a?
                 while (actorReadyToFire(a))
                 {
                     // Fire actor a
-                    startActorFiring(a);
+                    startActorFiring((TimedSDFactor *)a);
                 }
             }
 
             // Clock step
-            clkStep = clockStep();
+            clkStep = events.clockStep();
 
             // Deadlocked?
             if (clkStep == UINT_MAX)
@@ -899,6 +907,9 @@ namespace SDF
                 analyzeDeadlock(sp, dep);
                 return 0;
             }
+
+            // Advance the global clock
+            currentState.glbClk += clkStep;
         }
 
         return 0;
@@ -919,6 +930,8 @@ namespace SDF
         d = new StorageDistribution;
         d->sp = new TBufSize [g->nrChannels()];
         d->dep = new bool [g->nrChannels()];
+        for (uint c = 0; c < g->nrChannels(); c++)
+            d->dep[c] = false;
 
         return d;
     }
@@ -935,6 +948,33 @@ namespace SDF
         delete d;
     }
 
+    /**
+     * deleteStorageDistributionSets ()
+     * Deallocate memory for a linked-list of storage distribution sets and all
+     * distributions contained in these sets.
+     */
+    void SDFstateSpaceBufferAnalysis::deleteStorageDistributionSets(
+        StorageDistributionSet *ds)
+    {
+        StorageDistributionSet *dt;
+        StorageDistribution *d, *t;
+
+        while (ds != nullptr)
+        {
+            d = ds->distributions;
+            while (d != nullptr)
+            {
+                t = d->next;
+                deleteStorageDistribution(d);
+                d = t;
+            }
+
+            dt = ds;
+            ds = ds->next;
+            delete dt;
+        }
+    }
+
     /**
      * execStorageDistribution ()
      * Compute throughput and storage dependencies of the given storage
@@ -1413,7 +1453,7 @@ namespace SDF
     SDFstateSpaceBufferAnalysis::findNextStorageDistributionSet()
     {
         StorageDistribution *d, *t;
-        StorageDistributionSet *dp, *ds, *dt;
+        StorageDistributionSet *dp, *ds, *dt, *du;
 
         // Last explored distribution set
         dp = lastExploredStorageDistributionSet;
@@ -1467,17 +1507,17 @@ namespace SDF
         // Unexplored distributions left, but maximal throughput reached?
         if (ds != nullptr && ds->next != nullptr && ds->thr == maxThroughput)
         {
-            // Pointer to first set which must be removed
-            ds = ds->next;
+            // Pointer to first set which must be removed (ds is returned)
+            du = ds->next;
 
-            // Mark previous set as last set in list of minimal storage distr
-            ds->prev->next = nullptr;
+            // Mark ds as last set in list of minimal storage distr
+            ds->next = nullptr;
 
             // Remove all unexplored distributions (and sets)
-            while (ds != nullptr)
+            while (du != nullptr)
             {
-                // Remove all distributions within the set ds
-                d = ds->distributions;
+                // Remove all distributions within the set du
+                d = du->distributions;
                 while (d != nullptr)
                 {
                     t = d->next;
@@ -1486,10 +1526,10 @@ namespace SDF
                 }
 
                 // Temporary pointer to set
-                dt = ds;
+                dt = du;
 
                 // Next
-                ds = ds->next;
+                du = du->next;
 
                 // Cleanup dt
                 delete dt;
@@ -1513,4 +1553,455 @@ namespace SDF
         return ds;
     }
 
+    /**
+     * findStorageDistributionSet ()
+     * The function returns the smallest storage distribution set of the
+     * step-by-step search with a throughput of at least thrBound. Sets which
+     * have already been explored are checked first. Otherwise, the search
+     * continues till a set which meets the bound is found. When the function is
+     * called with increasing bounds, the complete trade-off space is explored
+     * only once. The function returns nullptr when the bound exceeds the
+     * maximal throughput of the graph.
+     */
+    StorageDistributionSet *
+    SDFstateSpaceBufferAnalysis::findStorageDistributionSet(const double thrBound)
+    {
+        StorageDistributionSet *ds;
+
+        // Bound met by a set which has already been explored?
+        if (lastExploredStorageDistributionSet != nullptr)
+        {
+            for (ds = minStorageDistributions; ds != nullptr; ds = ds->next)
+            {
+                if (ds->thr > 0 && ds->thr >= thrBound)
+                    return ds;
+
+                if (ds == lastExploredStorageDistributionSet)
+                    break;
+            }
+        }
+
+        // Continue the search till the bound is met
+        while ((ds = findNextStorageDistributionSet()) != nullptr)
+        {
+            if (ds->thr >= thrBound)
+                return ds;
+        }
+
+        return nullptr;
+    }
+
+    /**
+     * storeSearch ()
+     * The function writes the state of a step-by-step search to the stream. This
+     * state consists of the channels of the graph (their endpoints, rates and
+     * initial tokens), all storage distribution sets (explored and still to be
+     * explored), the throughput and storage dependencies of the explored
+     * distributions and the last explored set. The search can be resumed from
+     * this state with restoreSearch.
+     */
+    void SDFstateSpaceBufferAnalysis::storeSearch(ostream &out) const
+    {
+        uint nrSets = 0, nrDistributions, lastExplored = 0;
+        std::streamsize precision;
+        StorageDistributionSet *ds;
+        StorageDistribution *d;
+
+        // Position of the last explored set (0 when no set is explored)
+        for (ds = minStorageDistributions; ds != nullptr; ds = ds->next)
+        {
+            nrSets++;
+            if (ds == lastExploredStorageDistributionSet)
+                lastExplored = nrSets;
+        }
+
+        // Throughputs must be read back without loss of precision
+        precision = out.precision(std::numeric_limits<TDtime>::max_digits10);
+
+        out << "storageDistributions " << g->nrChannels() << " " << nrSets;
+        out << " " << lastExplored << endl;
+
+        for (uint c = 0; c < g->nrChannels(); c++)
+        {
+            SDFchannel *ch = g->getChannel(c);
+
+            out << "channel " << ch->getSrcActor()->getId();
+            out << " " << ch->getDstActor()->getId();
+            out << " " << ch->getSrcPort()->getRate();
+            out << " " << ch->getDstPort()->getRate();
+            out << " " << ch->getInitialTokens() << endl;
+        }
+
+        for (ds = minStorageDistributions; ds != nullptr; ds = ds->next)
+        {
+            nrDistributions = 0;
+            for (d = ds->distributions; d != nullptr; d = d->next)
+                nrDistributions++;
+
+            out << "set " << ds->sz << " " << ds->thr << " " << nrDistributions;
+            out << endl;
+
+            for (d = ds->distributions; d != nullptr; d = d->next)
+            {
+                out << d->sz << " " << d->thr;
+                for (uint c = 0; c < g->nrChannels(); c++)
+                    out << " " << d->sp[c];
+                for (uint c = 0; c < g->nrChannels(); c++)
+                    out << " " << d->dep[c];
+                out << endl;
+            }
+        }
+
+        out.precision(precision);
+    }
+
+    /**
+     * restoreSearch ()
+     * The function initializes the storage distribution search algorithm for
+     * the graph gr and continues the search from the state stored in the stream
+     * (see storeSearch). The function returns false when the stream does not
+     * contain a valid state for the graph, e.g. when the stored channels differ
+     * from the channels of gr. The search then starts from the lower bound on
+     * the storage space (as after initSearch).
+     */
+    bool SDFstateSpaceBufferAnalysis::restoreSearch(TimedSDFgraph *gr,
+            istream &in)
+    {
+        StorageDistributionSet *sets = nullptr, *ds = nullptr, *dsNew;
+        StorageDistributionSet *lastExplored = nullptr;
+        uint nrChannels, nrSets, lastExploredSet, nrDistributions;
+        StorageDistribution *d, *dp;
+        std::string keyword;
+        bool valid;
+
+        // Start a new search (used when the stored state cannot be resumed)
+        initSearch(gr);
+
+        // Header
+        in >> keyword >> nrChannels >> nrSets >> lastExploredSet;
+        valid = !in.fail() && keyword == "storageDistributions"
+                && nrChannels == g->nrChannels()
+                && lastExploredSet > 0 && lastExploredSet <= nrSets;
+
+        // Channels of the graph on which the search was performed
+        for (uint c = 0; valid && c < g->nrChannels(); c++)
+        {
+            SDFchannel *ch = g->getChannel(c);
+            CId srcActor, dstActor;
+            SDFrate srcRate, dstRate;
+            uint initialTokens;
+
+            in >> keyword >> srcActor >> dstActor >> srcRate >> dstRate;
+            in >> initialTokens;
+            valid = !in.fail() && keyword == "channel"
+                    && srcActor == ch->getSrcActor()->getId()
+                    && dstActor == ch->getDstActor()->getId()
+                    && srcRate == ch->getSrcPort()->getRate()
+                    && dstRate == ch->getDstPort()->getRate()
+                    && initialTokens == ch->getInitialTokens();
+        }
+
+        // Storage distribution sets
+        for (uint i = 0; valid && i < nrSets; i++)
+        {
+            dsNew = new StorageDistributionSet;
+            dsNew->distributions = nullptr;
+            dsNew->next = nullptr;
+            dsNew->prev = ds;
+            if (ds == nullptr)
+                sets = dsNew;
+            else
+                ds->next = dsNew;
+            ds = dsNew;
+
+            if (i + 1 == lastExploredSet)
+                lastExplored = ds;
+
+            in >> keyword >> ds->sz >> ds->thr >> nrDistributions;
+            valid = !in.fail() && keyword == "set" && nrDistributions > 0;
+
+            // Storage distributions within the set
+            dp = nullptr;
+            for (uint j = 0; valid && j < nrDistributions; j++)
+            {
+                d = newStorageDistribution();
+                d->next = nullptr;
+                d->prev = dp;
+                if (dp == nullptr)
+                    ds->distributions = d;
+                else
+                    dp->next = d;
+                dp = d;
+
+                in >> d->sz >> d->thr;
+                for (uint c = 0; c < g->nrChannels(); c++)
+                    in >> d->sp[c];
+                for (uint c = 0; c < g->nrChannels(); c++)
+                    in >> d->dep[c];
+                valid = !in.fail();
+            }
+        }
+
+        if (!valid)
+        {
+            deleteStorageDistributionSets(sets);
+            return false;
+        }
+
+        // Continue the search from the stored state
+        deleteStorageDistributionSets(minStorageDistributions);
+        minStorageDistributions = sets;
+        lastExploredStorageDistributionSet = lastExplored;
+
+        return true;
+    }
+
+    /**
+     * budgetExhausted ()
+     * The function returns true when the anytime search has used its time or
+     * exploration budget.
+     */
+    bool SDFstateSpaceBufferAnalysis::budgetExhausted()
+    {
+        if (distributionBudget != 0
+            && nrExploredDistributions >= distributionBudget)
+        {
+            return true;
+        }
+
+        if (timeBudget > 0)
+        {
+            stopTimer(&anytimeTimer);
+            if (fractionalSecondsElapsed(&anytimeTimer) >= timeBudget)
+                return true;
+        }
+
+        return false;
+    }
+
+    /**
+     * findUpperBoundDistribution ()
+     * The function searches greedily for a storage distribution with a
+     * throughput of at least thr. Starting from the lower bound on the storage
+     * space, all channels with a storage dependency are enlarged at once till
+     * the throughput is met. The amount by which a channel is enlarged doubles
+     * each time, so the number of explored distributions is logarithmic in the
+     * size of the distribution that is found. This size is an upper bound on
+     * the size of the smallest distribution which meets thr. The search is not
+     * limited by the budget, such that the anytime search always has a
+     * distribution to return. The function returns nullptr when no channel
+     * can be enlarged anymore.
+     */
+    StorageDistribution *SDFstateSpaceBufferAnalysis::findUpperBoundDistribution(
+        const TDtime thr)
+    {
+        vector<TBufSize> step(minSzStep, minSzStep + g->nrChannels());
+        StorageDistribution *d;
+        bool enlarged = true;
+
+        // Construct storage distribution with lower bound storage space
+        d = newStorageDistribution();
+        d->thr = 0;
+        d->sz = lbDistributionSz;
+        for (uint c = 0; c < g->nrChannels(); c++)
+            d->sp[c] = minSz[c];
+        d->next = nullptr;
+        d->prev = nullptr;
+
+        while (enlarged)
+        {
+            // Compute throughput and storage dependencies
+            nrExploredDistributions++;
+            execStorageDistribution(d);
+
+            // Throughput met?
+            if (d->thr > 0 && d->thr >= thr)
+                return d;
+
+            // Enlarge every channel which has a storage dependency
+            enlarged = false;
+            for (uint c = 0; c < g->nrChannels(); c++)
+            {
+                if (!d->dep[c] || g->getChannel(c)->getSrcActor()->getId()
+                    == g->getChannel(c)->getDstActor()->getId())
+                {
+                    continue;
+                }
+
+                d->sp[c] += step[c];
+                d->sz += step[c];
+                step[c] *= 2;
+                enlarged = true;
+            }
+        }
+
+        deleteStorageDistribution(d);
+
+        return nullptr;
+    }
+
+    /**
+     * refineBoundDistribution ()
+     * The function explores the storage distributions in order of increasing
+     * size (as findMinimalStorageDistributions) till a distribution with a
+     * throughput of at least thr is found, till the size of the best known
+     * distribution (best) is reached or till the budget is exhausted. The
+     * function returns the smallest distribution which meets thr that is known
+     * at that point. The lowerBound is set to the size of the smallest
+     * distribution which has not been explored completely. No distribution
+     * smaller then this bound meets thr.
+     */
+    StorageDistribution *SDFstateSpaceBufferAnalysis::refineBoundDistribution(
+        const TDtime thr, StorageDistribution *best, TBufSize &lowerBound)
+    {
+        StorageDistributionSet *ds;
+        StorageDistribution *d;
+
+        // Construct storage distribution with lower bound storage space
+        d = newStorageDistribution();
+        d->thr = 0;
+        d->sz = lbDistributionSz;
+        for (uint c = 0; c < g->nrChannels(); c++)
+            d->sp[c] = minSz[c];
+        d->next = nullptr;
+        d->prev = nullptr;
+
+        // Add distribution to set of distributions which must be checked
+        addStorageDistributionToChecklist(d);
+
+        ds = minStorageDistributions;
+        while (ds != nullptr)
+        {
+            // Best known distribution is not larger then unexplored ones?
+            if (best != nullptr && ds->sz >= best->sz)
+                break;
+
+            // All smaller distributions do not meet the throughput
+            lowerBound = ds->sz;
+
+            // Explore the distributions with size 'ds->sz'
+            for (d = ds->distributions; d != nullptr; d = d->next)
+            {
+                if (budgetExhausted())
+                    return best;
+
+                nrExploredDistributions++;
+                exploreStorageDistribution(ds, d);
+
+                // Found a smallest distribution which meets the throughput?
+                if (d->thr > 0 && d->thr >= thr)
+                {
+                    if (best != nullptr)
+                        deleteStorageDistribution(best);
+
+                    best = newStorageDistribution();
+                    best->sz = d->sz;
+                    best->thr = d->thr;
+                    for (uint c = 0; c < g->nrChannels(); c++)
+                    {
+                        best->sp[c] = d->sp[c];
+                        best->dep[c] = d->dep[c];
+                    }
+                    best->next = nullptr;
+                    best->prev = nullptr;
+
+                    return best;
+                }
+            }
+
+            // Explored distributions are not needed anymore (the distributions
+            // derived from them are in the checklist)
+            minStorageDistributions = ds->next;
+            if (minStorageDistributions != nullptr)
+                minStorageDistributions->prev = nullptr;
+            ds->next = nullptr;
+            deleteStorageDistributionSets(ds);
+
+            // Next
+            ds = minStorageDistributions;
+        }
+
+        // Best known distribution is a smallest one
+        if (best != nullptr)
+            lowerBound = best->sz;
+
+        return best;
+    }
+
+    /**
+     * analyzeAnytime ()
+     * The function searches the smallest storage distribution with a
+     * throughput of at least thrBound (or the maximal throughput of the graph
+     * when thrBound exceeds it). A greedy search first gives a distribution of
+     * which the size is an upper bound. This distribution is always computed,
+     * also when the budget is already exhausted. The search then explores the
+     * distributions in order of increasing size, starting from the lower bound
+     * on the storage space, till this upper bound is met. When the time
+     * (maxSeconds) or exploration budget (maxDistributions) is exhausted, the
+     * best distribution known at that moment is returned. The function returns
+     * a set with this distribution (or nullptr when the graph deadlocks) and
+     * sets lowerBound to a lower bound on the size of the smallest
+     * distribution. The returned distribution is a smallest one when its size
+     * is equal to this bound.
+     */
+    StorageDistributionSet *SDFstateSpaceBufferAnalysis::analyzeAnytime(
+        TimedSDFgraph *gr, const double thrBound, TBufSize &lowerBound,
+        const double maxSeconds, const unsigned long maxDistributions)
+    {
+        StorageDistributionSet *ds = nullptr;
+        StorageDistribution *best = nullptr;
+        TDtime thr;
+
+        // SDF graph
+        g = gr;
+
+        // Start with an empty set of storage distributions
+        minStorageDistributions = nullptr;
+        lastExploredStorageDistributionSet = nullptr;
+
+        // Budget
+        timeBudget = maxSeconds;
+        distributionBudget = maxDistributions;
+        nrExploredDistributions = 0;
+        startTimer(&anytimeTimer);
+
+        // Initialize bounds on the search space
+        initBoundsSearchSpace(g);
+        lowerBound = lbDistributionSz;
+
+        // Create a transition system
+        transitionSystem = new TransitionSystem(g);
+
+        // Throughput which must be met
+        thr = (thrBound < maxThroughput ? thrBound : maxThroughput);
+
+        // Search the space (no distribution has a positive throughput when the
+        // graph deadlocks)
+        if (maxThroughput > 0)
+        {
+            best = findUpperBoundDistribution(thr);
+            best = refineBoundDistribution(thr, best, lowerBound);
+        }
+
+        // Best known distribution
+        if (best != nullptr)
+        {
+            ds = new StorageDistributionSet;
+            ds->sz = best->sz;
+            ds->thr = best->thr;
+            ds->distributions = best;
+            ds->next = nullptr;
+            ds->prev = nullptr;
+        }
+
+        // Cleanup
+        deleteStorageDistributionSets(minStorageDistributions);
+        minStorageDistributions = nullptr;
+        delete [] minSz;
+        delete [] minSzStep;
+        delete transitionSystem;
+
+        return ds;
+    }
+
 }//namespace
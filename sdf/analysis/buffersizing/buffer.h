@@ -40,6 +40,8 @@
 
 #include "storage_distribution.h"
 #include "../../base/timed/graph.h"
+#include "../throughput/event_queue.h"
+#include "../throughput/state_store.h"
 namespace SDF
 {
     /**
@@ -66,6 +68,34 @@ namespace SDF
             void initSearch(TimedSDFgraph *gr);
             StorageDistributionSet *findNextStorageDistributionSet();
 
+            // Smallest storage distribution set of a step-by-step search which
+            // meets a throughput bound (one search serves a sorted list of
+            // bounds)
+            StorageDistributionSet *findStorageDistributionSet(
+                const double thrBound);
+
+            // Explored storage distribution sets of a step-by-step search
+            StorageDistributionSet *getStorageDistributionSets() const
+            {
+                return minStorageDistributions;
+            };
+            StorageDistributionSet *getLastExploredStorageDistributionSet() const
+            {
+                return lastExploredStorageDistributionSet;
+            };
+
+            // Save and resume a step-by-step search
+            void storeSearch(ostream &out) const;
+            bool restoreSearch(TimedSDFgraph *gr, istream &in);
+
+            // Anytime search for the smallest storage distribution which meets
+            // a throughput bound within a time (seconds) and exploration budget
+            // (a budget of 0 is unlimited)
+            StorageDistributionSet *analyzeAnytime(TimedSDFgraph *gr,
+                    const double thrBound, TBufSize &lowerBound,
+                    const double maxSeconds = 0,
+                    const unsigned long maxDistributions = 0);
+
         private:
 
             /***************************************************************************
@@ -107,6 +137,9 @@ namespace SDF
                             // Output state
                             void print(ostream &out);
 
+                            // Words which identify the state
+                            void pack(vector<unsigned long long> &words) const;
+
                             // State information
                             vector< list<SDFtime> > actClk;
                             vector< TBufSize > ch;
@@ -114,14 +147,11 @@ namespace SDF
                             unsigned long glbClk;
                     };
 
-                    // Sequence of states in transition system
-                    typedef list<State>      States;
-                    typedef States::iterator StatesIter;
-
                     // Constructor
                     TransitionSystem(TimedSDFgraph *gr)
                     {
                         g = gr;
+                        events.init(g);
                         initOutputActor();
                     };
 
@@ -133,7 +163,7 @@ namespace SDF
 
                 private:
                     // Store state
-                    bool storeState(State &s, StatesIter &pos);
+                    bool storeState(State &s, SDFstateSpaceStateStore::Index &pos);
 
                     // Clear list of stored states
                     void clearStoredStates()
@@ -150,14 +180,17 @@ namespace SDF
                     void analyzeDeadlock(const TBufSize *sp, bool *dep);
 
                     // Compute throughput from transition system
-                    TDtime computeThroughput(const StatesIter cycleIter);
+                    TDtime computeThroughput(
+                        const SDFstateSpaceStateStore::Index cycleStart);
 
                     // State transitions
                     bool actorReadyToFire(SDFactor *a);
                     void startActorFiring(TimedSDFactor *a);
-                    bool actorReadyToEnd(SDFactor *a);
                     void endActorFiring(SDFactor *a);
-                    SDFtime clockStep();
+
+                    // Channels changed since the previous state was stored
+                    void markChannelChanged(SDFchannel *c);
+                    void storePreviousState();
 
                     // Output actor
                     void initOutputActor();
@@ -170,9 +203,15 @@ namespace SDF
                     // Current and previous state
                     State currentState;
                     State previousState;
+                    vector<SDFchannel *> changedChannels;
+                    vector<bool> channelChanged;
 
-                    // List of visited states that are stored
-                    States storedStates;
+                    // Active actor firings and actors that may be enabled
+                    SDFstateSpaceEventQueue events;
+
+                    // Visited states that are stored
+                    SDFstateSpaceStateStore storedStates;
+                    vector<unsigned long long> packedState;
             };
 
             // Bounds on the search space
@@ -185,6 +224,7 @@ namespace SDF
             // Storage distributions
             StorageDistribution *newStorageDistribution();
             static void deleteStorageDistribution(StorageDistribution *d);
+            static void deleteStorageDistributionSets(StorageDistributionSet *ds);
             void execStorageDistribution(StorageDistribution *d);
             static void minimizeStorageDistributionsSet(StorageDistributionSet *ds);
             bool addStorageDistributionToChecklist(StorageDistribution *d);
@@ -193,6 +233,12 @@ namespace SDF
             void exploreStorageDistributionSet(StorageDistributionSet *ds);
             void findMinimalStorageDistributions(const double thrBound);
 
+            // Anytime search
+            bool budgetExhausted();
+            StorageDistribution *findUpperBoundDistribution(const TDtime thr);
+            StorageDistribution *refineBoundDistribution(const TDtime thr,
+                    StorageDistribution *best, TBufSize &lowerBound);
+
             // SDF graph
             TimedSDFgraph *g;
 
@@ -208,6 +254,12 @@ namespace SDF
             TBufSize *minSzStep;
             TBufSize lbDistributionSz;
             TDtime maxThroughput;
+
+            // Budget of the anytime search
+            CTimer anytimeTimer;
+            double timeBudget;
+            unsigned long distributionBudget;
+            unsigned long nrExploredDistributions;
     };
 
 }//namespace
@@ -221,21 +221,13 @@ namespace SDF
     void SDFstateSpaceBufferAnalysisNingGao::TransitionSystem::initOutputActor()
     {
         RepetitionVector repVec;
-        int min = INT_MAX;
-        SDFactor *a = NULL;
+        SDFactor *a;
 
         // Compute repetition vector
         repVec = computeRepetitionVector(g);
 
         // Select actor with lowest entry in repetition vector as output actor
-        for (SDFactorsIter iter = g->actorsBegin(); iter != g->actorsEnd(); iter++)
-        {
-            if (repVec[(*iter)->getId()] < min)
-            {
-                a = *iter;
-                min = repVec[a->getId()];
-            }
-        }
+        a = selectOutputActor(g);
 
         // Set output actor and its repetition vector count
         outputActor = a;
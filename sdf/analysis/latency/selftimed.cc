@@ -95,6 +95,31 @@ namespace SDF
         glbClk = 0;
     }
 
+    /**
+     * pack ()
+     * The function stores the words which identify the state in words. Two
+     * states are equal when their words are equal.
+     */
+    void SDFstateSpaceSelfTimedLatencyAnalysis::TransitionSystem::State::pack(
+        vector<unsigned long long> &words) const
+    {
+        words.clear();
+        words.push_back(glbClk);
+
+        for (uint i = 0; i < ch.size(); i++)
+            words.push_back(ch[i]);
+
+        for (uint i = 0; i < actClk.size(); i++)
+        {
+            words.push_back(actClk[i].size());
+            for (list<SDFtime>::const_iterator iter = actClk[i].begin();
+                 iter != actClk[i].end(); iter++)
+            {
+                words.push_back(*iter);
+            }
+        }
+    }
+
     /**
      * operator== ()
      * The function compares to states and returns true if they are equal.
@@ -132,21 +157,13 @@ namespace SDF
     void SDFstateSpaceSelfTimedLatencyAnalysis::TransitionSystem::initOutputActor()
     {
         RepetitionVector repVec;
-        int min = INT_MAX;
-        SDFactor *a = NULL;
+        SDFactor *a;
 
         // Compute repetition vector
         repVec = computeRepetitionVector(g);
 
         // Select actor with lowest entry in repetition vector as output actor
-        for (SDFactorsIter iter = g->actorsBegin(); iter != g->actorsEnd(); iter++)
-        {
-            if (repVec[(*iter)->getId()] < min)
-            {
-                a = *iter;
-                min = repVec[a->getId()];
-            }
-        }
+        a = selectOutputActor(g);
 
         // Set output actor and its repetition vector count
         outputActor = a->getId();
@@ -385,6 +402,7 @@ namespace SDF
 
         // Clear the list of stored states
         clearStoredStates();
+        cycleDetector.clear();
 
         // Create initial state
         currentState.init(g->nrActors(), g->nrChannels());
@@ -424,7 +442,18 @@ namespace SDF
                         if (repCnt == outputActorRepCnt)
                         {
                             // Reccurent state not yet seen
-                            if (!foundRecurrentState)
+                            if (!foundRecurrentState && cycleDetection)
+                            {
+                                // Compare state with the tortoise of the cycle
+                                // detection
+                                currentState.pack(packedState);
+                                if (cycleDetector.visit(packedState,
+                                                        currentState.glbClk))
+                                {
+                                    foundRecurrentState = true;
+                                }
+                            }
+                            else if (!foundRecurrentState)
                             {
                                 // Add state to hash of visited states
                                 if (!storeState(currentState, recurrentState))
@@ -450,6 +479,8 @@ namespace SDF
                         if (timeDstFire.size() >= timeSrcFire.size() + distance
                             && foundRecurrentState)
                         {
+                            if (cycleDetection)
+                                return cycleDetector.computeThroughput();
                             return computeThroughput(recurrentState);
                         }
                     }
@@ -521,7 +552,7 @@ namespace SDF
         ch = g->createChannel(srcActor, 1, srcActor, 1, 0);
 
         // Create a transition system
-        transitionSystem = new TransitionSystem(g);
+        transitionSystem = new TransitionSystem(g, cycleDetection);
 
         // Execute graph
         transitionSystem->execSDFgraph(srcActor, dstActor, timeSrcFire,
@@ -546,7 +577,7 @@ namespace SDF
         g->removeChannel(ch->getName());
 
         // Create a transition system
-        transitionSystem = new TransitionSystem(g);
+        transitionSystem = new TransitionSystem(g, cycleDetection);
 
         // Find all moments in time at which src and dst actor fire
         throughput = transitionSystem->execSDFgraph(srcActor, dstActor,
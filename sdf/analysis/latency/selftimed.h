@@ -37,6 +37,7 @@
 #define SDF_ANALYSIS_STATESPACE_LATENCY_SELFTIMED_H_INCLUDED
 
 #include "../../base/timed/graph.h"
+#include "../throughput/cycle_detector.h"
 
 namespace SDF
 {
@@ -49,7 +50,10 @@ namespace SDF
     {
         public:
             // Constructor
-            SDFstateSpaceSelfTimedLatencyAnalysis() {};
+            SDFstateSpaceSelfTimedLatencyAnalysis()
+            {
+                cycleDetection = false;
+            };
 
             // Destructor
             ~SDFstateSpaceSelfTimedLatencyAnalysis() {};
@@ -58,6 +62,13 @@ namespace SDF
             void analyze(TimedSDFgraph *g, SDFactor *srcActor, SDFactor *dstActor,
                          TDtime &latency, TDtime &throughput);
 
+            // Find the recurrent state with Brent's algorithm instead of
+            // storing all visited states
+            void setCycleDetection(const bool flag)
+            {
+                cycleDetection = flag;
+            };
+
         private:
 
             /***************************************************************************
@@ -98,6 +109,9 @@ namespace SDF
                             // Output state
                             void print(ostream &out);
 
+                            // Words which identify the state
+                            void pack(vector<unsigned long long> &words) const;
+
                             // State information
                             vector< list<SDFtime> > actClk;
                             vector< TBufSize > ch;
@@ -109,9 +123,11 @@ namespace SDF
                     typedef States::iterator StatesIter;
 
                     // Constructor
-                    TransitionSystem(TimedSDFgraph *gr)
+                    TransitionSystem(TimedSDFgraph *gr,
+                                     const bool detectCycle = false)
                     {
                         g = gr;
+                        cycleDetection = detectCycle;
                         initOutputActor();
                     };
 
@@ -157,7 +173,15 @@ namespace SDF
 
                     // List of visited states that are stored
                     States storedStates;
+
+                    // Recurrent-state detection without stored states
+                    bool cycleDetection;
+                    SDFstateSpaceCycleDetector cycleDetector;
+                    vector<unsigned long long> packedState;
             };
+
+            // Recurrent-state detection with Brent's algorithm
+            bool cycleDetection;
     };
 }// namespace SDF
 #endif
@@ -33,262 +33,385 @@
  * what you give them.   Happy coding!
  */
 
+
 #include "single_processor_random_staticorder.h"
 #include "../../base/algo/repetition_vector.h"
 #include "../../base/algo/components.h"
+#include <atomic>
+#include <mutex>
+#include <thread>
 
 namespace SDF
 {
-    // Random number generator
-    static MTRand mtRand;
+    // Number of attempts that share one random number stream
+#define RANDOM_STATICORDER_BLOCK_SIZE   64
 
     /**
-     * fireActor ()
-     * The function removes the number of tokens required for a firing of the actor
-     * from all input ports and it produces tokens on all output ports.
+     * RandomStaticOrderActor
+     * Ports and execution time of an actor. Channels are identified by their
+     * position in the token vector.
+     */
+    typedef struct _RandomStaticOrderActor
+    {
+        vector<CId> inChannels;
+        vector<TBufSize> inRates;
+        vector<CId> outChannels;
+        vector<TBufSize> outRates;
+        vector<CId> successors;
+        SDFtime execTime;
+    } RandomStaticOrderActor;
+
+    /**
+     * RandomStaticOrderModel
+     * Read-only description of the graph which is shared by all sampling
+     * threads. Each thread simulates the firings on a private token vector.
+     */
+    typedef struct _RandomStaticOrderModel
+    {
+        vector<RandomStaticOrderActor> actors;
+        vector<TBufSize> initialTokens;
+        RepetitionVector repVec;
+        CId srcActor;
+        CId dstActor;
+    } RandomStaticOrderModel;
+
+    /**
+     * RandomStaticOrderSampler
+     * Private state of a sampling thread.
+     */
+    typedef struct _RandomStaticOrderSampler
+    {
+        vector<TBufSize> tokens;
+        RepetitionVector demandList;
+        vector<CId> readyList;
+        vector<bool> listed;
+    } RandomStaticOrderSampler;
+
+    /**
+     * createModel ()
+     * The function creates the model of the graph g used to sample random
+     * static-order schedules.
      */
     static
-    void fireActor(SDFactor *a)
+    void createModel(TimedSDFgraph *g, SDFactor *srcActor, SDFactor *dstActor,
+                     RandomStaticOrderModel &m)
     {
-        for (SDFportsIter iter = a->portsBegin(); iter != a->portsEnd(); iter++)
+        m.actors.resize(g->nrActors());
+        m.initialTokens.resize(g->nrChannels());
+        m.repVec = computeRepetitionVector(g);
+        m.srcActor = srcActor->getId();
+        m.dstActor = dstActor->getId();
+
+        for (SDFchannelsIter iter = g->channelsBegin();
+             iter != g->channelsEnd(); iter++)
+        {
+            SDFchannel *c = *iter;
+
+            m.initialTokens[c->getId()] = c->getInitialTokens();
+        }
+
+        for (SDFactorsIter iter = g->actorsBegin(); iter != g->actorsEnd(); iter++)
         {
-            SDFport *p = *iter;
-            SDFchannel *c = p->getChannel();
+            TimedSDFactor *a = (TimedSDFactor *)(*iter);
+            RandomStaticOrderActor &x = m.actors[a->getId()];
 
-            if (p->getType() == SDFport::In)
+            x.execTime = a->getExecutionTime();
+
+            for (SDFportsIter iterP = a->portsBegin();
+                 iterP != a->portsEnd(); iterP++)
             {
-                if (c->getInitialTokens() < p->getRate())
+                SDFport *p = *iterP;
+                SDFchannel *c = p->getChannel();
+
+                if (p->getType() == SDFport::In)
                 {
-                    cerr << "actor: " << a->getId() << endl;
-                    throw CException("Not enough tokens to fire actor.");
+                    x.inChannels.push_back(c->getId());
+                    x.inRates.push_back(p->getRate());
+                }
+                else
+                {
+                    x.outChannels.push_back(c->getId());
+                    x.outRates.push_back(p->getRate());
+                    x.successors.push_back(c->getDstActor()->getId());
                 }
-
-                c->setInitialTokens(c->getInitialTokens() - p->getRate());
-            }
-            else
-            {
-                c->setInitialTokens(c->getInitialTokens() + p->getRate());
             }
         }
     }
 
     /**
-     * isActorReady ()
-     * The function checks wether there are enough tokens on the input ports
-     * to fire the actor.
+     * fireActor ()
+     * The function removes the number of tokens required for a firing of the actor
+     * from all input ports and it produces tokens on all output ports.
      */
     static
-    bool isActorReady(SDFactor *a)
+    void fireActor(const RandomStaticOrderActor &a, vector<TBufSize> &tokens)
     {
-        for (SDFportsIter iter = a->portsBegin(); iter != a->portsEnd(); iter++)
+        for (uint i = 0; i < a.inChannels.size(); i++)
         {
-            SDFport *p = *iter;
-
-            if (p->getType() == SDFport::In)
-            {
-                SDFchannel *c = p->getChannel();
+            if (tokens[a.inChannels[i]] < a.inRates[i])
+                throw CException("Not enough tokens to fire actor.");
 
-                if (c->getInitialTokens() < p->getRate())
-                    return false;
-            }
+            tokens[a.inChannels[i]] -= a.inRates[i];
         }
 
-        return true;
+        for (uint i = 0; i < a.outChannels.size(); i++)
+            tokens[a.outChannels[i]] += a.outRates[i];
     }
 
     /**
-     * updateActorReadyList ()
-     * The function updates the list of ready actors after the firing of actor a.
+     * isActorReady ()
+     * The function checks wether there are enough tokens on the input ports
+     * to fire the actor.
      */
     static
-    void updateActorReadyList(SDFactors &readyList, SDFactor *a,
-                              RepetitionVector &demandList)
+    bool isActorReady(const RandomStaticOrderActor &a,
+                      const vector<TBufSize> &tokens)
     {
-        // Is actor a no longer ready?
-        if (!isActorReady(a) || demandList[a->getId()] == 0)
+        for (uint i = 0; i < a.inChannels.size(); i++)
         {
-            // Remove actor a from the ready list
-            for (SDFactorsIter iter = readyList.begin();
-                 iter != readyList.end(); iter++)
-            {
-                if ((*iter)->getId() == a->getId())
-                {
-                    readyList.erase(iter);
-                    break;
-                }
-            }
+            if (tokens[a.inChannels[i]] < a.inRates[i])
+                return false;
         }
 
-        // Which actors are ready because actor a fired?
-        for (SDFportsIter iter = a->portsBegin(); iter != a->portsEnd(); iter++)
-        {
-            SDFport *p = *iter;
-
-            if (p->getType() == SDFport::Out)
-            {
-                SDFactor *b = p->getChannel()->getDstActor();
-
-                if (isActorReady(b) && demandList[b->getId()] > 0)
-                {
-                    bool alreadyListed = false;
+        return true;
+    }
 
-                    // Add actor only when not yet in the list
-                    for (SDFactorsIter iter = readyList.begin();
-                         iter != readyList.end() && !alreadyListed; iter++)
-                    {
-                        if ((*iter)->getId() == b->getId())
-                            alreadyListed = true;
-                    }
-                    if (!alreadyListed)
-                        readyList.push_back(b);
-                }
-            }
+    /**
+     * addActorToReadyList ()
+     * The function adds actor a to the list of ready actors when it is ready,
+     * has a remaining demand and is not yet in the list.
+     */
+    static
+    void addActorToReadyList(const RandomStaticOrderModel &m,
+                             RandomStaticOrderSampler &s, const CId a)
+    {
+        if (!s.listed[a] && s.demandList[a] > 0
+            && isActorReady(m.actors[a], s.tokens))
+        {
+            s.readyList.push_back(a);
+            s.listed[a] = true;
         }
     }
 
     /**
-     * getRandomActorFromActorReadyList ()
-     * The function returns a random actor from the list.
+     * fireRandomActor ()
+     * The function fires a random actor from the list of ready actors and updates
+     * the list of ready actors. When decreaseDemand is true, the demand of the
+     * actor is lowered. The actor that fired is returned.
      */
     static
-    SDFactor *getRandomActorFromActorReadyList(SDFactors &readyList)
+    CId fireRandomActor(const RandomStaticOrderModel &m,
+                        RandomStaticOrderSampler &s, MTRand &mtRand,
+                        bool decreaseDemand)
     {
-        int n;
+        uint n = mtRand.randInt((uint)s.readyList.size() - 1);
+        CId a = s.readyList[n];
+        const RandomStaticOrderActor &x = m.actors[a];
 
-        // Select a random actor from the list
-        n = mtRand.randInt(readyList.size() - 1);
+        // Fire the actor
+        fireActor(x, s.tokens);
 
-        for (SDFactorsIter iter = readyList.begin();
-             iter != readyList.end(); iter++)
+        // Update demand list
+        if (decreaseDemand)
+            s.demandList[a]--;
+
+        // Is actor a no longer ready?
+        if (s.demandList[a] == 0 || !isActorReady(x, s.tokens))
         {
-            if (n == 0)
-                return *iter;
-            n--;
+            s.readyList[n] = s.readyList.back();
+            s.readyList.pop_back();
+            s.listed[a] = false;
         }
 
-        return NULL;
+        // Which actors are ready because actor a fired?
+        for (uint i = 0; i < x.successors.size(); i++)
+            addActorToReadyList(m, s, x.successors[i]);
+
+        return a;
     }
 
     /**
      * execSDFgraph ()
-     * Fire the actors in the SDF graph. The number of firings is n (or less in case
+     * Fire the actors in the SDF graph according to a random static-order
+     * schedule, starting from the initial tokens of the graph. The latency
+     * between the source and destination actor is returned (UINT_MAX in case
      * of deadlock).
      */
     static
-    SDFtime execSDFgraph(TimedSDFgraph *g, SDFactor *srcActor, SDFactor *dstActor)
+    SDFtime execSDFgraph(const RandomStaticOrderModel &m,
+                         RandomStaticOrderSampler &s, MTRand &mtRand)
     {
-        RepetitionVector demandList;
         bool firstSrcFiring = true;
         SDFtime latency = 0;
-        SDFactors readyList;
-        TimedSDFactor *a;
 
-        // Initial demand list
-        demandList = computeRepetitionVector(g);
+        // Initial tokens
+        s.tokens = m.initialTokens;
 
-        // Block source actor from firing
-        demandList[srcActor->getId()] = 0;
+        // Initial demand list; block source actor from firing
+        s.demandList = m.repVec;
+        s.demandList[m.srcActor] = 0;
 
         // Create initial list of ready actors
-        for (SDFactorsIter iter = g->actorsBegin(); iter != g->actorsEnd(); iter++)
-        {
-            a = (TimedSDFactor *)(*iter);
-
-            if (isActorReady(a) && demandList[a->getId()] > 0)
-            {
-                readyList.push_back(a);
-            }
-        }
+        s.readyList.clear();
+        s.listed.assign(m.actors.size(), false);
+        for (CId a = 0; a < m.actors.size(); a++)
+            addActorToReadyList(m, s, a);
 
         // Fire till deadlock
-        while (!readyList.empty())
-        {
-            // Get a random actor from the list of ready actors
-            a = (TimedSDFactor *)getRandomActorFromActorReadyList(readyList);
-            ASSERT(a != NULL, "ready list is empty");
-
-            // Fire the actor
-            fireActor(a);
-
-            // Update the list of ready actors
-            updateActorReadyList(readyList, a, demandList);
-        }
+        while (!s.readyList.empty())
+            fireRandomActor(m, s, mtRand, false);
 
         // Update demand list
-        demandList = computeRepetitionVector(g);
+        s.demandList = m.repVec;
 
         // Create initial list of ready actors
-        for (SDFactorsIter iter = g->actorsBegin(); iter != g->actorsEnd(); iter++)
-        {
-            a = (TimedSDFactor *)(*iter);
-
-            if (isActorReady(a))
-            {
-                readyList.push_back(a);
-            }
-        }
+        for (CId a = 0; a < m.actors.size(); a++)
+            addActorToReadyList(m, s, a);
 
         // Firings
-        while (!readyList.empty())
+        while (!s.readyList.empty())
         {
-            // Get a random actor from the list of ready actors
-            a = (TimedSDFactor *)getRandomActorFromActorReadyList(readyList);
-            ASSERT(a != NULL, "ready list is empty");
-
-            // Fire the actor
-            fireActor(a);
-
-            // Update demand list
-            demandList[a->getId()]--;
-
-            // Update the list of ready actors
-            updateActorReadyList(readyList, a, demandList);
+            CId a = fireRandomActor(m, s, mtRand, true);
 
             // Update latency; firing source actor?
-            if (a->getId() == srcActor->getId() && firstSrcFiring)
+            if (a == m.srcActor && firstSrcFiring)
             {
-                latency = a->getExecutionTime();
+                latency = m.actors[a].execTime;
                 firstSrcFiring = false;
             }
             else
             {
-                latency += a->getExecutionTime();
+                latency += m.actors[a].execTime;
             }
 
             // All firings destination actor complete?
-            if (a->getId() == dstActor->getId() && demandList[a->getId()] == 0)
-            {
+            if (a == m.dstActor && s.demandList[a] == 0)
                 return latency;
-            }
         }
 
         // Deadlock
         return UINT_MAX;
     }
 
+    /**
+     * RandomStaticOrderSearch
+     * Search state shared by all sampling threads.
+     */
+    typedef struct _RandomStaticOrderSearch
+    {
+        RandomStaticOrderModel model;
+        uint nrAttempts;
+        uint nrBlocks;
+        uint seed;
+        SDFtime lowerBound;
+        std::atomic<uint> nextBlock;
+        std::atomic<bool> boundReached;
+        std::mutex lock;
+        SDFtime minLatency;
+        CString error;
+    } RandomStaticOrderSearch;
+
+    /**
+     * sampleRandomStaticOrders ()
+     * The function repeatedly takes the next block of attempts from the search
+     * and samples the random static-order schedules of this block. Each block
+     * uses its own random number stream which is derived from the seed and the
+     * index of the block.
+     */
+    static
+    void sampleRandomStaticOrders(RandomStaticOrderSearch *search)
+    {
+        RandomStaticOrderSampler s;
+        SDFtime minLatency = UINT_MAX;
+        uint b;
+
+        try
+        {
+            while (!search->boundReached
+                   && (b = search->nextBlock++) < search->nrBlocks)
+            {
+                MTRand::uint32 streamSeed[2] = { search->seed, b };
+                MTRand mtRand(streamSeed, 2);
+                uint first = b * RANDOM_STATICORDER_BLOCK_SIZE;
+                uint last = first + RANDOM_STATICORDER_BLOCK_SIZE;
+
+                if (last > search->nrAttempts)
+                    last = search->nrAttempts;
+
+                for (uint attempt = first; attempt < last; attempt++)
+                {
+                    SDFtime latency = execSDFgraph(search->model, s, mtRand);
+
+                    if (latency < minLatency)
+                        minLatency = latency;
+
+                    // Known lower bound reached?
+                    if (minLatency <= search->lowerBound)
+                    {
+                        search->boundReached = true;
+                        break;
+                    }
+                }
+            }
+        }
+        catch (CException &e)
+        {
+            std::lock_guard<std::mutex> guard(search->lock);
+            search->error = e.getMessage();
+            search->boundReached = true;
+        }
+
+        std::lock_guard<std::mutex> guard(search->lock);
+        if (minLatency < search->minLatency)
+            search->minLatency = minLatency;
+    }
+
     /**
      * latencyAnalysisForRandomStaticOrderSingleProc ()
      * The function computes the latency for a random static-order schedule on
      * a single processor system. The minimal latency for the specified number of
      * attempts is returned.
+     *
+     * The attempts are divided into blocks which are distributed over nrThreads
+     * threads. Since every block has its own random number stream, the result
+     * only depends on the seed and not on the number of threads. The search
+     * stops as soon as a schedule is found whose latency is at most lowerBound.
      */
     extern
     SDFtime latencyAnalysisForRandomStaticOrderSingleProc(TimedSDFgraph *g,
-            SDFactor *srcActor, SDFactor *dstActor, uint nrAttempts)
+            SDFactor *srcActor, SDFactor *dstActor, uint nrAttempts,
+            uint nrThreads, uint seed, SDFtime lowerBound)
     {
-        uint attempt = 0;
-        SDFtime latency, minLatency = UINT_MAX;
-
-        while (attempt < nrAttempts)
+        RandomStaticOrderSearch search;
+        vector<std::thread> threads;
+
+        // The graph is not modified; all threads share one model of it
+        createModel(g, srcActor, dstActor, search.model);
+
+        search.nrAttempts = nrAttempts;
+        search.nrBlocks = (nrAttempts + RANDOM_STATICORDER_BLOCK_SIZE - 1)
+                          / RANDOM_STATICORDER_BLOCK_SIZE;
+        search.seed = seed;
+        search.lowerBound = lowerBound;
+        search.nextBlock = 0;
+        search.boundReached = false;
+        search.minLatency = UINT_MAX;
+
+        if (nrThreads <= 1)
         {
-            latency = execSDFgraph(g, srcActor, dstActor);
-
-            if (latency < minLatency)
-                minLatency = latency;
-
-            attempt++;
+            sampleRandomStaticOrders(&search);
         }
+        else
+        {
+            for (uint t = 0; t < nrThreads; t++)
+                threads.push_back(std::thread(sampleRandomStaticOrders, &search));
+            for (uint t = 0; t < nrThreads; t++)
+                threads[t].join();
+        }
+
+        if (!search.error.empty())
+            throw CException(search.error);
 
-        return minLatency;
+        return search.minLatency;
     }
-}//namespace
\ No newline at end of file
+}//namespace
@@ -43,10 +43,13 @@ namespace SDF
      * latencyAnalysisForRandomStaticOrderSingleProc ()
      * The function computes the latency for a random static-order schedule on
      * a single processor system. The minimal latency for the specified number of
-     * attempts is returned.
+     * attempts is returned. The attempts are sampled on nrThreads threads. The
+     * result is reproducible for a given seed, independent of the number of
+     * threads. Sampling stops once the (known) lowerBound is reached.
      */
     SDFtime latencyAnalysisForRandomStaticOrderSingleProc(TimedSDFgraph *g,
-            SDFactor *srcActor, SDFactor *dstActor, uint nrAttempts);
+            SDFactor *srcActor, SDFactor *dstActor, uint nrAttempts,
+            uint nrThreads = 1, uint seed = 0, SDFtime lowerBound = 0);
 }//namespace
 #endif
 
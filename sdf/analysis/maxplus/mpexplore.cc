@@ -224,12 +224,21 @@ namespace SDF
             ActorList::const_iterator i = G->actors->begin();
             while (! E->isEmpty())
             {
+                ActorList::const_iterator start = i;
                 Actor *a;
                 while (true) // find an enabled actor
                 {
                     a = *i;
                     if (E->getValue(a) > 0 && x->actorEnabled(a)) break;
                     if (++i == G->actors->end()) i = G->actors->begin();
+
+                    // no enabled actor left before the iteration is complete
+                    if (i == start)
+                    {
+                        delete E;
+                        delete x;
+                        throw CException("Graph deadlocks.");
+                    }
                 }
                 E->decreaseValue(a);
                 G->fireSymbolic(x, a);
@@ -254,6 +263,8 @@ namespace SDF
                 }
                 t = x->nextToken();
             }
+
+            delete x;
             return MG;
         }
 
@@ -37,12 +37,10 @@
 #include "../../base/hsdf/check.h"
 #include "../../base/algo/components.h"
 #include "../../base/algo/cycle.h"
-#include "../../base/algo/graph.h"
+#include "../../base/algo/csr.h"
 
 namespace SDF
 {
-    //#define __CALC_MCM_PER_CYCLE__
-
     /**
      * maximumCycleMeanCycle ()
      * The function computes the maximum cycle mean of a cycle.
@@ -57,7 +55,7 @@ namespace SDF
         {
             auto *uu = (TimedSDFactor *)(*cycleIter);
             cycleIter.operator++();
-            TimedSDFactor *vv;// = (TimedSDFactor *)(*(cycleIter));
+            TimedSDFactor *vv;
 
             // Add execution time of actor to execution time of the cycle
             t += uu->getExecutionTime();
@@ -67,6 +65,10 @@ namespace SDF
                 // Next actor in cycle is the first actor
                 vv = (TimedSDFactor *)(*cycle.begin());
             }
+            else
+            {
+                vv = (TimedSDFactor *)(*cycleIter);
+            }
 
             // Find channel with minimum number of tokens to next actor in cycle
             int tokensCh = 0;
@@ -103,217 +105,221 @@ namespace SDF
         return ((CDouble)t) / ((CDouble) tokens);
     }
 
-#ifndef __CALC_MCM_PER_CYCLE__
-
     /**
-     * mcmGetAdjacentActors ()
-     * The function returns a list with actors directly reachable from
-     * actor a.
+     * MCMcycleModel
+     * Read-only description of an HSDF graph which is shared by all threads
+     * that compute the cycle means of the simple cycles in the graph.
      */
-    static
-    v_uint mcmGetAdjacentActors(uint a, v_uint &nodeId, v_uint &actorId,
-                                vector<v_uint> &graph, uint nrNodes)
+    typedef struct _MCMcycleModel
     {
-        v_uint actors;
+        // Channels of the graph (parallel channels are merged)
+        CSRgraph graph;
 
-        uint u = nodeId[a];
-        for (uint v = 0; v < nrNodes; v++)
-        {
-            if (graph[u][v] == 1)
-                actors.push_back(actorId[v]);
-        }
+        // Execution time of each actor
+        vector<SDFtime> executionTime;
 
-        return actors;
-    }
+        // Minimal number of initial tokens on the channels of each edge
+        v_uint tokens;
+
+        // Upper bound on the maximum cycle mean
+        CDouble upperBound;
+    } MCMcycleModel;
 
     /**
-     * mcmSimpleCycleVisit ()
-     * The visitor function of the DFS based algorithm used for detecting
-     * simple cycles and computing the MCM of them.
+     * MCMcycleVisitor
+     * Computes the maximum of the cycle means of the cycles passed to it.
      */
-    static
-    void mcmSimpleCycleVisit(uint a, TimedSDFgraph *g, v_uint &nodeId,
-                             v_uint &actorId, vector<v_uint> &graph, uint size, v_int &color,
-                             v_uint &pi, CDouble &mcmCycles)
+    class MCMcycleVisitor : public CSRcycleVisitor
     {
-        // color[a] <- gray
-        color[a] = 1;
+        public:
+            // Constructor
+            MCMcycleVisitor(const MCMcycleModel &m) : model(m), mcm(0) {};
 
-        // for each b in Adj(e)
-        v_uint adj = mcmGetAdjacentActors(a, nodeId, actorId, graph, size);
-        for (uint i = 0; i < adj.size(); i++)
-        {
-            uint b = adj[i];
+            // Destructor
+            virtual ~MCMcycleVisitor() {};
 
-            // do if color[b] = white
-            if (color[b] == 0)
-            {
-                pi[b] = a;
-                mcmSimpleCycleVisit(b, g, nodeId, actorId, graph, size,
-                                    color, pi, mcmCycles);
-            }
-            else if (color[b] == 1)
+            // Visit a cycle
+            virtual bool visitCycle(const v_uint &cycle);
+
+            // Maximum cycle mean of all visited cycles
+            CDouble getMCM() const
             {
-                CDouble mcmCycle;
-                SDFgraphCycle cycle;
+                return mcm;
+            };
 
-                // Create new cycle
-                cycle.push_front(g->getActor(a));
+        private:
+            const MCMcycleModel &model;
+            CDouble mcm;
+    };
 
-                uint u = a;
-                while (u != b)
+    /**
+     * visitCycle ()
+     * The function computes the cycle mean of the cycle. The enumeration of
+     * cycles is stopped when the mean reaches the upper bound of the model.
+     */
+    bool MCMcycleVisitor::visitCycle(const v_uint &cycle)
+    {
+        unsigned long long t = 0, tokens = 0;
+        CDouble mcmCycle;
+
+        for (uint i = 0; i < cycle.size(); i++)
+        {
+            uint u = cycle[i];
+            uint v = cycle[(i + 1) % cycle.size()];
+
+            // Execution time of the actor and tokens on the edge to the next
+            // actor in the cycle
+            t += model.executionTime[u];
+            for (uint e = model.graph.beginSuccessors(u);
+                 e < model.graph.endSuccessors(u); e++)
+            {
+                if (model.graph.getTarget(e) == v)
                 {
-                    u = pi[u];
-                    cycle.push_front(g->getActor(u));
+                    tokens += model.tokens[e];
+                    break;
                 }
-
-                // MCM of the cycle
-                mcmCycle = maximumCycleMeanCycle(g, cycle);
-
-                // Maximum of all cycles
-                mcmCycles = MAX(mcmCycles, mcmCycle);
             }
         }
 
-        // color[a] <- white
-        color[a] = 0;
+        if (tokens == 0)
+            mcmCycle = INFINITY;
+        else
+            mcmCycle = ((CDouble)t) / ((CDouble) tokens);
+
+        mcm = MAX(mcm, mcmCycle);
+
+        return mcm < model.upperBound;
     }
 
     /**
-     * mcmSimpleCycles ()
-     * The function performs a depth first search on the graph to discover all
-     * simple cycles in the graph. The cycle mean of each cycle is computed
-     * and the maximum cycle mean is returned.
+     * createMCMcycleModel ()
+     * The function creates the model of the HSDF graph g used to compute the
+     * cycle means.
      */
     static
-    CDouble mcmSimpleCycles(TimedSDFgraph *g, bool transpose)
+    void createMCMcycleModel(TimedSDFgraph *g, MCMcycleModel &m)
     {
-        CDouble mcmGraph = 0.0;
-        v_uint pi(g->nrActors());
+        m.graph = CSRgraph(g);
+        m.executionTime.resize(g->nrActors());
+        m.tokens.assign(m.graph.nrEdges(), UINT_MAX);
+        m.upperBound = INFINITY;
 
-        // Split graph in strongly connected components
-        SDFgraphComponents components = stronglyConnectedComponents(g);
-
-        if (components.size() == 0)
-            return INFINITY;
-
-        // Iterate over all components
-        for (SDFgraphComponentsIter iter = components.begin();
-             iter != components.end(); iter++)
+        v_uint edge(g->nrActors(), UINT_MAX);
+        for (SDFactorsIter iter = g->actorsBegin(); iter != g->actorsEnd(); iter++)
         {
-            v_uint actorId, nodeId;
-            vector<v_uint> graph;
-            SDFgraphComponent &component = *iter;
-
-            // Convert component to graph structure
-            sdfComponentToGraph(g, component, nodeId, actorId, graph, transpose);
+            TimedSDFactor *a = (TimedSDFactor *)(*iter);
+            uint u = a->getId();
 
-            // For each a in A' do color[a] <- white
-            v_int color(g->nrActors(), 0);
+            m.executionTime[u] = a->getExecutionTime();
 
-            // For each a in A' do pi[a] <- NIL
-            for (uint a = 0; a < g->nrActors(); a++)
-                pi[a] = 0;
-
-            // For an actor a in A' (take the first actor)
-            uint a = actorId[0];
-
-            // color[a] <- gray
-            color[a] = 1;
-
-            // For each actor b in Adj(a, s)
-            v_uint adj = mcmGetAdjacentActors(a, nodeId, actorId, graph,
-                                              component.size());
-            for (uint i = 0; i < adj.size(); i++)
+            // Edge to each successor of a
+            for (uint e = m.graph.beginSuccessors(u);
+                 e < m.graph.endSuccessors(u); e++)
             {
-                uint b = adj[i];
-
-                if (color[b] == 0)
-                {
-                    pi[b] = a;
-                    mcmSimpleCycleVisit(b, g, nodeId, actorId, graph,
-                                        component.size(), color, pi, mcmGraph);
-                }
-                else if (color[b] == 1)
-                {
-                    CDouble mcmCycle;
-                    SDFgraphCycle cycle;
+                edge[m.graph.getTarget(e)] = e;
+            }
 
-                    // Self-loop
-                    cycle.push_front(g->getActor(a));
+            // Minimal number of tokens on the channels to each successor
+            for (SDFportsIter iterP = a->portsBegin();
+                 iterP != a->portsEnd(); iterP++)
+            {
+                SDFport *p = *iterP;
 
-                    // MCM of the cycle
-                    mcmCycle = maximumCycleMeanCycle(g, cycle);
+                if (p->getType() != SDFport::Out)
+                    continue;
 
-                    // Graph is maximum of all cycles
-                    mcmGraph = MAX(mcmGraph, mcmCycle);
-                }
+                uint e = edge[p->getChannel()->getDstActor()->getId()];
+                m.tokens[e] = MIN(m.tokens[e],
+                                  (uint)p->getChannel()->getInitialTokens());
             }
         }
-
-        return mcmGraph;
     }
 
     /**
-     * maximumCycleMeanCycles ()
-     * The function computes the maximum cycle mean of a HSDF graph using
-     * the cycle-based definition of the MCM.
+     * hasCycleWithoutTokens ()
+     * The function returns true when the graph of the model contains a cycle
+     * without initial tokens.
      */
-    CDouble maximumCycleMeanCycles(TimedSDFgraph *g)
+    static
+    bool hasCycleWithoutTokens(const MCMcycleModel &m)
     {
-        CDouble mcmGraph;
+        CSRgraph graph;
+        CSRcomponents components;
+        v_uint src, dst;
 
-        // Check that graph g is an HSDF graph
-        if (!isHSDFgraph(g))
-            throw CException("Graph is not an HSDF graph.");
+        // Edges without tokens
+        for (uint u = 0; u < m.graph.nrNodes(); u++)
+        {
+            for (uint e = m.graph.beginSuccessors(u);
+                 e < m.graph.endSuccessors(u); e++)
+            {
+                if (m.tokens[e] != 0)
+                    continue;
 
-        // Check that the graph g is a strongly connected graph
-        //if (!isStronglyConnectedGraph(g))
-        //    throw CException("Graph is not strongly connected.");
+                // Self-loop without tokens
+                if (m.graph.getTarget(e) == u)
+                    return true;
 
-        // Find simple cycles in graph and calculate MCM for each cycle
-        mcmGraph = mcmSimpleCycles(g, false);
+                src.push_back(u);
+                dst.push_back(m.graph.getTarget(e));
+            }
+        }
 
-        return mcmGraph;
-    }
+        // Any non-trivial component contains a cycle
+        graph.construct(m.graph.nrNodes(), src, dst);
+        stronglyConnectedComponents(graph, components);
 
-#else // __CALC_MCM_PER_CYCLE__
+        return components.nrComponents() != m.graph.nrNodes();
+    }
 
     /**
      * maximumCycleMeanCycles ()
      * The function computes the maximum cycle mean of a HSDF graph using
-     * the cycle-based definition of the MCM.
+     * the cycle-based definition of the MCM. The simple cycles of the graph
+     * are enumerated with Johnson's algorithm and the mean of each cycle is
+     * computed as soon as the cycle is found, so no cycles are stored.
+     *
+     * A graph with a cycle without tokens has an infinite MCM. Otherwise,
+     * when the graph is strongly connected, Howard's algorithm gives the mean
+     * of a critical cycle. No cycle has a larger mean, so the enumeration
+     * stops as soon as a cycle with this mean is found. The components of
+     * Johnson's algorithm are distributed over nrThreads threads.
      */
-    CDouble maximumCycleMeanCycles(TimedSDFgraph *g)
+    CDouble maximumCycleMeanCycles(TimedSDFgraph *g, const uint nrThreads)
     {
+        MCMcycleModel model;
+        vector<CSRcycleVisitor *> threadVisitors;
         CDouble mcmGraph = 0;
 
         // Check that graph g is an HSDF graph
         if (!isHSDFgraph(g))
             throw CException("Graph is not an HSDF graph.");
 
-        // Check that the graph g is a strongly connected graph
-        //if (!isStronglyConnectedGraph(g))
-        //    throw CException("Graph is not strongly connected.");
+        if (g->nrActors() == 0)
+            return INFINITY;
 
-        // Find simple cycles in graph
-        SDFgraphCycles cycles = findSimpleCycles(g);
+        createMCMcycleModel(g, model);
 
-        // Calculate MCM for each cycle
-        for (SDFgraphCyclesIter iter = cycles.begin(); iter != cycles.end(); iter++)
-        {
-            CDouble mcmCycle;
-            SDFgraphCycle cycle = *iter;
+        // A cycle without tokens has an infinite cycle mean
+        if (hasCycleWithoutTokens(model))
+            return INFINITY;
 
-            // MCM of the cycle
-            mcmCycle = maximumCycleMeanCycle(g, cycle);
+        // Upper bound on the MCM of a strongly connected graph
+        if (model.graph.nrEdges() != 0 && isStronglyConnectedGraph(g))
+            model.upperBound = maximumCycleMeanHoward(g);
 
-            // Graph is maximum of all cycles
-            mcmGraph = MAX(mcmGraph, mcmCycle);
-        }
+        // Find simple cycles in graph and calculate MCM for each cycle
+        vector<MCMcycleVisitor> visitors(nrThreads == 0 ? 1 : nrThreads,
+                                         MCMcycleVisitor(model));
+        for (uint t = 0; t < visitors.size(); t++)
+            threadVisitors.push_back(&visitors[t]);
+
+        findSimpleCycles(model.graph, threadVisitors);
+
+        // Graph is maximum of all cycles
+        for (uint t = 0; t < visitors.size(); t++)
+            mcmGraph = MAX(mcmGraph, visitors[t].getMCM());
 
         return mcmGraph;
     }
-
-#endif // __CALC_MCM_PER_CYCLE__
-}//namespace SDF
\ No newline at end of file
+}//namespace SDF
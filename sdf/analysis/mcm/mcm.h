@@ -44,9 +44,10 @@ namespace SDF
     /**
      * maximumCycleMeanCycles ()
      * The function computes the maximum cycle mean of a HSDF graph using
-     * the cycle-based definition of the MCM.
+     * the cycle-based definition of the MCM. The cycles are enumerated by
+     * nrThreads threads without storing them.
      */
-    CDouble maximumCycleMeanCycles(TimedSDFgraph *g);
+    CDouble maximumCycleMeanCycles(TimedSDFgraph *g, const uint nrThreads = 1);
 
     /**
      * maximumCycleMeanKarp ()
@@ -79,9 +80,21 @@ namespace SDF
     /**
      * maximumCycleMeanYoungTarjanOrlin ()
      * The function computes the maximum cycle mean of a HSDF graph using
-     * Young-Tarjan-Orlin's algorithm.
+     * Young-Tarjan-Orlin's algorithm. The graph does not need to be strongly
+     * connected. Its strongly connected components are analyzed by nrThreads
+     * threads.
      */
-    CDouble maximumCycleYoungTarjanOrlin(TimedSDFgraph *g, bool mcmFormulation);
+    CDouble maximumCycleYoungTarjanOrlin(TimedSDFgraph *g, bool mcmFormulation,
+                                         const uint nrThreads = 1);
+
+    /**
+     * maximumCycleMeanSDFYoungTarjanOrlin ()
+     * The function computes the maximum cycle mean of an SDF graph using
+     * Young-Tarjan-Orlin's algorithm without converting the graph to an HSDF
+     * graph. The MCM is computed on the graph with one node per initial token
+     * which is derived from the max-plus matrix of the graph.
+     */
+    CDouble maximumCycleMeanSDFYoungTarjanOrlin(TimedSDFgraph *g);
 
 }//namespace
 #endif
@@ -37,6 +37,9 @@
 #include "base/base.h"
 #include "mcmgraph.h"
 #include "../../base/hsdf/check.h"
+#include "../../base/algo/csr.h"
+#include "../../base/algo/repetition_vector.h"
+#include "../maxplus/mpexplore.h"
 #include "mcm.h"
 namespace SDF
 {
@@ -454,354 +457,167 @@ namespace SDF
     }
 
     /**
-     * getAdjacentNodes ()
-     * The function returns a list with nodes directly reachable from
-     * node a (in case transpose if false). If transpose is 'true', the
-     * graph is transposed and the function returns a list with nodes
-     * which are directly reachable from a in the transposed graph.
+     * transformSDFtoMCMgraph ()
+     * The function converts an SDF graph directly to a weighted directed graph
+     * with one node for each initial token. The edges are the finite entries
+     * of the max-plus matrix of one iteration of the graph.
      */
-    static
-    MCMnodes getAdjacentNodes(MCMnode *a, bool transpose)
+    MCMgraph *transformSDFtoMCMgraph(TimedSDFgraph *g)
     {
-        MCMnodes nodes;
+        MaxPlusAnalysis::Exploration mpe;
+        vector<MCMnode *> nodes;
+        MCMgraph *mcmGraph;
+        Matrix *matrix;
+        CId id = 0;
+        uint N;
+
+        // Check that graph g is consistent
+        if (!isSDFgraphConsistent(g))
+            throw CException("Graph is not consistent.");
+
+        // Symbolic execution of one iteration of the graph
+        MaxPlusAnalysis::GraphDecoration::Graph G(g);
+        mpe.G = &G;
+        mpe.g = g;
+        matrix = mpe.convertToMaxPlusMatrix();
+
+        // Create a node for each initial token
+        mcmGraph = new MCMgraph;
+        N = matrix->getSize();
+        for (uint i = 0; i < N; i++)
+        {
+            nodes.push_back(new MCMnode(i, true));
+            mcmGraph->addNode(nodes[i]);
+        }
 
-        if (!transpose)
+        // Token i depends on token j when entry (i,j) of the matrix is finite
+        for (uint j = 0; j < N; j++)
         {
-            for (MCMedgesIter iter = a->out.begin(); iter != a->out.end(); iter++)
+            for (uint i = 0; i < N; i++)
             {
-                MCMedge *e = *iter;
+                MPTime w = matrix->get(i, j);
 
-                if (e->visible)
-                    nodes.push_back(e->dst);
+                if (!MP_ISMINUSINFINITY(w))
+                    mcmGraph->addEdge(id++, nodes[j], nodes[i], w, 1);
             }
         }
-        else
-        {
-            for (MCMedgesIter iter = a->in.begin(); iter != a->in.end(); iter++)
-            {
-                MCMedge *e = *iter;
 
-                if (e->visible)
-                    nodes.push_back(e->src);
-            }
-        }
+        delete matrix;
 
-        return nodes;
+        return mcmGraph;
     }
 
     /**
-     * getNextNode ()
-     * The function returns the node from the list of nodes with the highest
-     * order. Its order is set to -1. If all nodes have order -1, a NULL pointer is
-     * returned.
+     * Extract the strongly connected components from the graph. These components
+     * are returned as a set of MCM graphs. All nodes which belong to at least
+     * one of the strongly connected components are set to visible in the graph g,
+     * all other nodes are made invisible. Also edges between two nodes in (possibly
+     * different) strongly connected components are made visible and all others
+     * invisible. The graph g consists in the end of only nodes which are part of
+     * a strongly connnected component and all the edges between these nodes. Some
+     * MCM algorithms work also on this graph (which reduces the execution time
+     * needed in some of the conversion algorithms).
      */
-    static
-    MCMnode *getNextNode(const MCMnodes &nodes, v_int &order)
+    void stronglyConnectedMCMgraph(MCMgraph *g, MCMgraphs &components)
     {
-        MCMnode *a = NULL;
-        int orderA = -1;
-
-        // Find actor with largest order
-        for (MCMnodesCIter iter = nodes.begin(); iter != nodes.end(); iter++)
+        CSRgraph csr;
+        CSRcomponents c;
+        vector<MCMnode *> nodes, copies;
+        vector<MCMgraph *> comps;
+        v_uint src, dst, nrEdges;
+        uint nrNodes = 0;
+
+        // Index the nodes on their id
+        for (MCMnodesCIter iter = g->getNodes().begin();
+             iter != g->getNodes().end(); iter++)
+        {
+            if ((*iter)->id >= nrNodes)
+                nrNodes = (*iter)->id + 1;
+        }
+        nodes.resize(nrNodes, NULL);
+        for (MCMnodesCIter iter = g->getNodes().begin();
+             iter != g->getNodes().end(); iter++)
         {
-            MCMnode *b = *iter;
-
-            if (orderA < order[b->id])
-            {
-                a = b;
-                orderA = order[b->id];
-            }
+            nodes[(*iter)->id] = *iter;
         }
 
-        // All actors have order -1?
-        if (orderA == -1)
-            return NULL;
-
-        return a;
-    }
-
-    /**
-     * dfsVisit ()
-     * The visitor function of the DFS algorithm.
-     */
-    static
-    void dfsVisit(MCMnode *u, int &time, v_int &color, v_int &d, v_int &f,
-                  MCMnode **pi, bool transpose)
-    {
-        // color[u] <- gray
-        color[u->id] = 1;
-
-        // d[u] <- time <- time + 1
-        time++;
-        d[u->id] = time;
-
-        // for each v in Adj(e)
-        MCMnodes adj = getAdjacentNodes(u, transpose);
-        for (MCMnodesIter iter = adj.begin(); iter != adj.end(); iter++)
+        // Strongly connected components of the visible edges
+        for (MCMedgesCIter iter = g->getEdges().begin();
+             iter != g->getEdges().end(); iter++)
         {
-            MCMnode *v = *iter;
+            MCMedge *e = *iter;
 
-            // do if color[v] = white
-            if (color[v->id] == 0)
+            if (e->visible)
             {
-                pi[v->id] = u;
-                dfsVisit(v, time, color, d, f, pi, transpose);
+                src.push_back(e->src->id);
+                dst.push_back(e->dst->id);
             }
         }
+        csr.construct(nrNodes, src, dst);
+        stronglyConnectedComponents(csr, c);
 
-        // color[u] <- black
-        color[u->id] = 2;
-
-        // f[u] <- time <- time + 1
-        time++;
-        f[u->id] = time;
-    }
-
-    /**
-     * dfsMCMgraph ()
-     * The function performs a depth first search on the graph. The discover
-     * time (d), finish time (f) and predecessor tree (pi) are passed back.
-     * The graph is transposed if the argument 't' is 'true'. Vertices are
-     * considered in decreasing order of f[u].
-     *
-     * The function derives an 'order' vector from the vector 'f'. Actors are
-     * considered in decreasing order according to this vector. When an actor
-     * is visited, its order is set to -1. At the end, all actors must have
-     * order -1 (i.e. all actors are visited).
-     */
-    void dfsMCMgraph(MCMgraph *g, v_int &d, v_int &f, MCMnode **pi, bool transpose)
-    {
-        int time;
-
-        // for each u in G do order[u] <- f[u]
-        v_int order(f);
-
-        // for each u in G do color[u] <- white
-        v_int color(g->nrVisibleNodes(), 0);
-
-        // time <- 0
-        time = 0;
-
-        // for each u in G do pi[u] <- NIL
-        for (uint u = 0; u < g->nrVisibleNodes(); u++)
-            pi[u] = NULL;
-
-        // for each u in G (visit in order given by order)
-        for (MCMnode *a = getNextNode(g->getNodes(), order); a != NULL;
-             a = getNextNode(g->getNodes(), order))
+        // A component is a strongly connected component when it contains at
+        // least one edge (i.e. more than one node or a self-loop)
+        nrEdges.resize(c.nrComponents(), 0);
+        for (uint i = 0; i < src.size(); i++)
         {
-            // Mark node as visited
-            order[a->id] = -1;
-
-            // if color[u] = white
-            if (color[a->id] == 0)
-                dfsVisit(a, time, color, d, f, pi, transpose);
+            if (c.component[src[i]] == c.component[dst[i]])
+                nrEdges[c.component[src[i]]]++;
         }
-    }
-
-    /**
-     * addNodeToComponent ()
-     * The function adds a new copy of a node to the component and it
-     * also creates copies for all edges between this node and all nodes
-     * already in the component.
-     */
-    static
-    void addNodeToComponent(MCMnode *n, MCMgraph *comp)
-    {
-        MCMnode *m;
-
-        // Create a copy of n and add it to the component
-        m = new MCMnode(n->id, true);
-        comp->addNode(m);
 
-        // Check all edges of n for inclusion in the component
-        for (MCMedgesIter iter = n->out.begin(); iter != n->out.end(); iter++)
+        // Create a graph for each component and make its nodes visible. All
+        // other nodes are made invisible.
+        comps.resize(c.nrComponents(), NULL);
+        copies.resize(nrNodes, NULL);
+        for (uint k = 0; k < c.nrComponents(); k++)
         {
-            MCMedge *e = *iter;
-
-            if (!e->visible)
-                continue;
-
-            // Is destination node in the component?
-            for (MCMnodesCIter iterN = comp->getNodes().begin();
-                 iterN != comp->getNodes().end(); iterN++)
+            if (nrEdges[k] != 0)
             {
-                if (e->dst->id == (*iterN)->id)
-                {
-                    // Add a copy of the edge to the component
-                    MCMedge *eN = new MCMedge(e->id, e->visible);
-                    eN->d = e->d;
-                    eN->w = e->w;
-                    eN->src = m;
-                    eN->dst = *iterN;
-                    comp->addEdge(eN);
-                    break;
-                }
+                comps[k] = new MCMgraph;
+                components.push_back(comps[k]);
             }
-        }
-        for (MCMedgesIter iter = n->in.begin(); iter != n->in.end(); iter++)
-        {
-            MCMedge *e = *iter;
 
-            // Is source node in the component?
-            for (MCMnodesCIter iterN = comp->getNodes().begin();
-                 iterN != comp->getNodes().end(); iterN++)
+            for (uint i = c.begin[k]; i < c.begin[k + 1]; i++)
             {
-                if (e->src->id == (*iterN)->id)
-                {
-                    // Add a copy of the edge to the component
-                    MCMedge *eN = new MCMedge(e->id, e->visible);
-                    eN->d = e->d;
-                    eN->w = e->w;
-                    eN->src = *iterN;
-                    eN->dst = m;
-                    comp->addEdge(eN);
-                    break;
-                }
-            }
-        }
-    }
+                MCMnode *n = nodes[c.nodes[i]];
 
-    /**
-     * treeVisitChildren ()
-     * The function visits all children of the actor 'u'. The parent-child
-     * relation is given via the vector 'pi'.
-     */
-    static
-    bool treeVisitChildren(MCMgraph *g, MCMnode **pi, MCMnode *u, MCMgraph *comp)
-    {
-        bool children = false;
-
-        for (uint i = 0; i < g->getNodes().size(); i++)
-        {
-            // Node v points to node u (i.e. v is a child of u)?
-            if (pi[i] != NULL && pi[i]->id == u->id)
-            {
-                MCMnode *v = NULL;
+                if (n == NULL)
+                    continue;
 
-                for (MCMnodesCIter iter = g->getNodes().begin();
-                     iter != g->getNodes().end(); iter++)
+                n->visible = (comps[k] != NULL);
+                if (n->visible)
                 {
-                    if ((*iter)->id == i)
-                    {
-                        v = *iter;
-                        break;
-                    }
+                    copies[n->id] = new MCMnode(n->id, true);
+                    comps[k]->addNode(copies[n->id]);
                 }
-                ASSERT(v != NULL, "The must always be a node v.");
-
-                // Add node v to the component
-                v->visible = true;
-                addNodeToComponent(v, comp);
-                children = true;
-
-                // Find all children of v in the tree
-                treeVisitChildren(g, pi, v, comp);
             }
         }
 
-        return children;
-    }
-
-    /**
-     * findComponentsInMCMgraph ()
-     * The function determines the strongly connected components in the graph. To do
-     * this, it performs depth-first walk on the forest given by 'pi'.
-     */
-    static
-    void findComponentsInMCMgraph(MCMgraph *g, MCMnode **pi, MCMgraphs &components)
-    {
-        MCMgraph *comp;
-
-        // Set all node as invisible
-        for (MCMnodesCIter iter = g->getNodes().begin(); iter != g->getNodes().end(); iter++)
+        // Add a copy of all edges inside a component to the component and
+        // make all edges to invisible nodes also invisible
+        for (MCMedgesCIter iter = g->getEdges().begin();
+             iter != g->getEdges().end(); iter++)
         {
-            MCMnode *n = *iter;
-
-            n->visible = false;
-        }
+            MCMedge *e = *iter;
 
-        // Find the strongly connected component and make all of its nodes visible
-        for (MCMnodesCIter iter = g->getNodes().begin(); iter != g->getNodes().end(); iter++)
-        {
-            MCMnode *n = *iter;
+            if (!e->visible)
+                continue;
 
-            if (pi[n->id] == NULL)
+            if (!e->src->visible || !e->dst->visible)
             {
-                // Create a new graph for the component
-                comp = new MCMgraph;
-
-                // Find all children of n in the tree
-                if (treeVisitChildren(g, pi, n, comp))
-                {
-                    // Node n has children, so it belongs to the strongly
-                    // connected component
-                    n->visible = true;
-                    addNodeToComponent(n, comp);
-                }
-                else
-                {
-                    // Node n may have a self-loop making it a strongly
-                    // connected component
-                    for (MCMedgesIter iterE = n->in.begin();
-                         iterE != n->in.end(); iterE++)
-                    {
-                        // Is edge a self-loop?
-                        if ((*iterE)->src->id == n->id)
-                        {
-                            n->visible = true;
-                            addNodeToComponent(n, comp);
-                        }
-                    }
-                }
-
-                // Found a strongly connected component (at least one edge)?
-                if (comp->nrVisibleEdges() > 0)
-                    components.push_back(comp);
-                else
-                    delete comp;
+                e->visible = false;
+            }
+            else if (c.component[e->src->id] == c.component[e->dst->id])
+            {
+                MCMedge *eN = new MCMedge(e->id, true);
+                eN->d = e->d;
+                eN->w = e->w;
+                eN->src = copies[e->src->id];
+                eN->dst = copies[e->dst->id];
+                comps[c.component[e->src->id]]->addEdge(eN);
             }
         }
 
-        // Make all edges to invisible nodes also invisible
-        for (MCMedgesCIter iter = g->getEdges().begin(); iter != g->getEdges().end(); iter++)
-        {
-            MCMedge *e = *iter;
-
-            if (e->visible)
-                if (!e->src->visible || !e->dst->visible)
-                    e->visible = false;
-        }
-    }
-
-    /**
-     * Extract the strongly connected components from the graph. These components
-     * are returned as a set of MCM graphs. All nodes which belong to at least
-     * one of the strongly connected components are set to visible in the graph g,
-     * all other nodes are made invisible. Also edges between two nodes in (possibly
-     * different) strongly connected components are made visible and all others
-     * invisible. The graph g consists in the end of only nodes which are part of
-     * a strongly connnected component and all the edges between these nodes. Some
-     * MCM algorithms work also on this graph (which reduces the execution time
-     * needed in some of the conversion algorithms).
-     */
-    void stronglyConnectedMCMgraph(MCMgraph *g, MCMgraphs &components)
-    {
-        // Initialize
-        v_int d(g->nrVisibleNodes());
-        v_int f(g->nrVisibleNodes(), 0);
-        MCMnode **pi = (MCMnode **)malloc(sizeof(MCMnode *)*g->nrVisibleNodes());
-        ASSERT(pi != NULL, "Failled malloc");
-
-        // Call dfs(g) to compute f[u] for each u
-        dfsMCMgraph(g, d, f, pi, false);
-
-        // Call dfs(gT), consider the vertices in order of decreasing f[u]
-        dfsMCMgraph(g, d, f, pi, true);
-
-        // Component is given by the vertices of the tree in the depth-first forest
-        findComponentsInMCMgraph(g, pi, components);
-
 #if 0
         // Print the MCM graph in dot-format
         cerr << "digraph g {" << endl;
@@ -818,9 +634,6 @@ namespace SDF
         }
         cerr << "}" << endl;
 #endif
-
-        // Cleanup
-        free(pi);
     }
 
     /**
@@ -215,6 +215,19 @@ namespace SDF
      */
     MCMgraph *transformHSDFtoMCMgraph(TimedSDFgraph *g, bool mcmFormulation = true);
 
+    /**
+     * transformSDFtoMCMgraph ()
+     * The function converts an SDF graph directly to a weighted directed graph
+     * with one node for each initial token. An edge (j,i) with weight w and
+     * one delay expresses that token i is produced in the next iteration at
+     * least w time units after token j is available. The graph is derived from
+     * the max-plus matrix of one iteration of the graph. No HSDF graph is
+     * constructed, which keeps the graph small when the graph has few initial
+     * tokens and a large repetition vector. The graph can be used as input for
+     * an MCM algorithm.
+     */
+    MCMgraph *transformSDFtoMCMgraph(TimedSDFgraph *g);
+
     /**
      * Extract the strongly connected components from the graph. These components
      * are returned as a set of MCM graphs. All nodes which belong to at least
@@ -43,8 +43,12 @@
 #include "mcmgraph.h"
 #include "../../base/hsdf/check.h"
 #include "../../base/algo/components.h"
+#include "mcmyto.h"
 
 #include <float.h>
+#include <atomic>
+#include <mutex>
+#include <thread>
 namespace SDF
 {
     typedef struct Node
@@ -97,6 +101,21 @@ namespace SDF
 #define NILN (node *) NULL
 #define  NILA (arc *) NULL
 
+    /**
+     * YTOstorage
+     * The memory used by the YTO algorithm. The vectors only grow, so a
+     * workspace which is used for a series of graphs allocates memory only
+     * when a graph is larger than all graphs analyzed before.
+     */
+    struct YTOstorage
+    {
+        vector<struct Node> nodes;
+        vector<struct Arc> arcs;
+        vector<struct Arc *> heap;
+        vector<struct Arc *> cycle;
+        vector<MCMedge *> criticalCycle;
+    };
+
     /*
      * d_heap implementation
      * ---------------------
@@ -252,58 +271,66 @@ namespace SDF
     }
 
     static inline
-    bool ALLOC_HEAP(d_heap *h, long k)
-    {
-        h->items = (item *) malloc(k * sizeof(item));
-        if (h->items == (item *) NULL)
-            return false;
-        else
-        {
-            h->max_size = k;
-            h->size = 0;
-            return true;
-        }
-    }
-
-    static inline
-    void DEALLOC_HEAP(d_heap *h)
+    void INIT_HEAP(d_heap *h, item *items, long k)
     {
-        free(h->items);
+        h->items = items;
+        h->max_size = k;
+        h->size = 0;
     }
 
-    static long update_level;
-    static node *upd_nodes;
-
     /**
      * update_subtree ()
-     * recursive subtree traversal function, produces a one-way liked list of nodes
+     * Subtree traversal function, produces a one-way liked list of nodes
      * contained in subtree updates node levels and costs of paths along sub-tree to
-     * nodes contained in it.
+     * nodes contained in it. The subtree is visited in pre-order without
+     * recursion (walking back up via the parent links), so that deep trees do
+     * not overflow the stack. The function returns the head of the list.
      */
     static
-    void update_subtree(node *root)
+    node *update_subtree(node *root, long level)
     {
-        node *vptr;
-
-        root->level = update_level;
-        root->link = upd_nodes;
-        upd_nodes = root;
-        root->in_list = true;
+        node *upd_nodes = NILN;
+        node *vptr = root;
 
-        if (root->first_child != NILN)
+        while (true)
         {
-            ++update_level;
-            vptr = root->first_child;
-            do
+            vptr->level = level;
+            vptr->link = upd_nodes;
+            upd_nodes = vptr;
+            vptr->in_list = true;
+
+            // Descend to the first child
+            if (vptr->first_child != NILN)
             {
-                vptr->cost_t = root->cost_t + vptr->parent_in->cost;
-                vptr->transit_time_t = root->transit_time_t
-                                       + vptr->parent_in->transit_time;
-                update_subtree(vptr);
+                node *wptr = vptr->first_child;
+
+                wptr->cost_t = vptr->cost_t + wptr->parent_in->cost;
+                wptr->transit_time_t = vptr->transit_time_t
+                                       + wptr->parent_in->transit_time;
+                vptr = wptr;
+                level++;
+                continue;
+            }
+
+            // Move to the next sibling of the node or of one of its ancestors
+            while (vptr != root)
+            {
+                node *pptr = vptr->parent_in->tail;
+
                 vptr = vptr->right_sibl;
+                if (vptr != pptr->first_child)
+                {
+                    vptr->cost_t = pptr->cost_t + vptr->parent_in->cost;
+                    vptr->transit_time_t = pptr->transit_time_t
+                                           + vptr->parent_in->transit_time;
+                    break;
+                }
+                vptr = pptr;
+                level--;
             }
-            while (vptr != root->first_child);
-            --update_level;
+
+            if (vptr == root)
+                return upd_nodes;
         }
     }
 
@@ -396,11 +423,12 @@ namespace SDF
      * 9) goto (6);
      */
     static
-    void mmcycle(graph *gr, double *lambda, arc **cycle, long *len)
+    void mmcycle(graph *gr, double *lambda, arc **cycle, long *len,
+                 item *heapItems)
     {
         double min, infty, akey, lambda_ini;
         arc *aptr, *par_aptr, *vmin_aptr, *min_aptr;
-        node *sptr, *uptr, *vptr, *wptr;
+        node *sptr, *uptr, *vptr, *wptr, *upd_nodes;
         bool foundCycle;
         d_heap h;
 
@@ -459,8 +487,7 @@ namespace SDF
 
 
         // d-heap used for maintenance of vertex keys
-        if (! ALLOC_HEAP(&h, gr->n_nodes))
-            throw CException("Failed allocating heap");
+        INIT_HEAP(&h, heapItems, gr->n_nodes);
 
         // compute initial vertex keys
         for (vptr = &(gr->nodes[gr->n_nodes - 1L]); vptr >= gr->nodes; vptr--)
@@ -566,10 +593,8 @@ namespace SDF
             // subtree rooted at v has u as parent node now, update level and cost
             // entries of its nodes accordingly and produce list of nodes contained
             // in subtree
-            upd_nodes = NILN;
-            update_level = uptr->level + 1L;
+            upd_nodes = update_subtree(vptr, uptr->level + 1L);
 
-            update_subtree(vptr);
             // now compute new keys of arcs into nodes that have acquired a new
             // shortest path, such arcs have head or tail in the subtree rooted at
             // "vptr", update vertex keys at the same time, nodes to be checked are
@@ -651,7 +676,6 @@ namespace SDF
             }
         }
 
-        DEALLOC_HEAP(&h);
         if (cycle != NULL && len != NULL)
         {
             *len = 0L;
@@ -685,15 +709,26 @@ namespace SDF
     static
     void convertMCMgraphToYTOgraph(MCMgraph *g,
                                    graph *gr, double(*costFunction)(MCMedge *e),
-                                   double(*transit_timeFunction)(MCMedge *e))
+                                   double(*transit_timeFunction)(MCMedge *e),
+                                   YTOstorage &s)
     {
         node *x;
         arc *a;
 
         gr->n_nodes = g->nrVisibleNodes();
         gr->n_arcs = g->nrVisibleEdges();
-        gr->nodes = (node *)malloc((gr->n_nodes + 1) * sizeof(node));
-        gr->arcs = (arc *)malloc((gr->n_arcs + gr->n_nodes) * sizeof(arc));
+
+        // Grow the storage when needed
+        if (s.nodes.size() < (size_t)gr->n_nodes + 1)
+            s.nodes.resize(gr->n_nodes + 1);
+        if (s.arcs.size() < (size_t)(gr->n_arcs + gr->n_nodes))
+            s.arcs.resize(gr->n_arcs + gr->n_nodes);
+        if (s.heap.size() < (size_t)gr->n_nodes + 1)
+            s.heap.resize(gr->n_nodes + 1);
+        if (s.cycle.size() < (size_t)gr->n_arcs + 1)
+            s.cycle.resize(gr->n_arcs + 1);
+        gr->nodes = &s.nodes[0];
+        gr->arcs = &s.arcs[0];
 
         // create nodes
         // TODO: there is something fishy here, we count the number of *visible* nodes, but visibility is not used here!
@@ -821,57 +856,137 @@ namespace SDF
         return e->d;
     }
 
+
+    /**
+     * getNegatedWeight ()
+     * The function returns the negated weight associated with an edge.
+     */
+    static double getNegatedWeight(MCMedge *e)
+    {
+        return -e->w;
+    }
+
     /**
-     * maxCycleMeanAndCriticalCycleYoungTarjanOrlin ()
-     * The function computes the maximum cycle mean of edge weight of
-     * an MCMgraph using Young-Tarjan-Orlin's algorithm.
-     * It returns both the MCM and a critical cycle
-     * The critical cycle is only returned if cycle and len are not NULL. Then *cycle points
-     * to an array of *MCMEdges of the critical cycle and *len indicates the length of the cycle.
-     * *cycle is a freshly allocated array and it is the caller's obligation to deallocate it
-     * in due time.
+     * YTOworkspace ()
+     * Constructor.
      */
-    CDouble maxCycleMeanAndCriticalCycleYoungTarjanOrlin(MCMgraph *mcmGraph, MCMedge *** cycle, uint *len)
+    YTOworkspace::YTOworkspace()
     {
+        storage = new YTOstorage;
+    }
+
+    /**
+     * ~YTOworkspace ()
+     * Destructor.
+     */
+    YTOworkspace::~YTOworkspace()
+    {
+        delete storage;
+    }
+
+    /**
+     * getCriticalCycle ()
+     * The function returns the critical cycle found by the last analysis
+     * which used the workspace.
+     */
+    const vector<MCMedge *> &YTOworkspace::getCriticalCycle() const
+    {
+        return storage->criticalCycle;
+    }
+
+    /**
+     * defaultYTOworkspace ()
+     * The function returns the workspace of the calling thread. It is used by
+     * the functions which do not get a workspace from their caller.
+     */
+    static
+    YTOworkspace &defaultYTOworkspace()
+    {
+        static thread_local YTOworkspace workspace;
+
+        return workspace;
+    }
+
+    /**
+     * minCycleRatioYTO ()
+     * The function computes the minimum cycle ratio of cost over transit time
+     * of an MCMgraph using Young-Tarjan-Orlin's algorithm. All memory is taken
+     * from the workspace w. The edges of the critical cycle are stored in the
+     * workspace in the order in which mmcycle finds them.
+     */
+    static
+    double minCycleRatioYTO(MCMgraph *mcmGraph, YTOworkspace &w,
+                            double(*costFunction)(MCMedge *e),
+                            double(*transit_timeFunction)(MCMedge *e))
+    {
+        YTOstorage &s = w.getStorage();
         double mincr;
         graph ytoGraph;
-        arc **ytoCycle;
         long ytoCycLen;
 
         // Convert the graph to an input graph for the YTO algorithm
-        convertMCMgraphToYTOgraph(mcmGraph, &ytoGraph, constOne, getWeight);
+        convertMCMgraphToYTOgraph(mcmGraph, &ytoGraph, costFunction,
+                                  transit_timeFunction, s);
 
-        if (cycle != NULL && len != NULL)
-        {
-            // allocate space for the critical cycle
-            ytoCycle = (arc **) malloc(sizeof(arc *) * mcmGraph->nrVisibleEdges());
+        // Find minimum cycle ratio
+        mmcycle(&ytoGraph, &mincr, &s.cycle[0], &ytoCycLen, &s.heap[0]);
 
-            // Find maximum cycle mean
-            mmcycle(&ytoGraph, &mincr, ytoCycle, &ytoCycLen);
+        s.criticalCycle.clear();
+        for (long i = 0; i < ytoCycLen; i++)
+            s.criticalCycle.push_back(s.cycle[i]->mcmEdge);
 
-            *len = ytoCycLen;
+        return mincr;
+    }
 
-            *cycle = (MCMedge **) malloc(sizeof(MCMedge *) * (*len));
+    /**
+     * copyCriticalCycle ()
+     * The function returns a copy of the critical cycle stored in the
+     * workspace in a freshly allocated array.
+     */
+    static
+    void copyCriticalCycle(const YTOworkspace &w, MCMedge ***cycle, uint *len)
+    {
+        const vector<MCMedge *> &criticalCycle = w.getCriticalCycle();
 
-            for (uint i = 0; i < *len; i++)
-            {
-                (*cycle)[i] = ytoCycle[i]->mcmEdge;
-            }
+        *len = criticalCycle.size();
+        *cycle = (MCMedge **) malloc(sizeof(MCMedge *) * (*len));
 
-            free(ytoCycle);
+        for (uint i = 0; i < *len; i++)
+            (*cycle)[i] = criticalCycle[i];
+    }
 
-        }
-        else
-        {
-            // Find maximum cycle mean without cycle
-            mmcycle(&ytoGraph, &mincr, NULL, NULL);
-        }
+    /**
+     * maxCycleMeanYoungTarjanOrlin ()
+     * The function computes the maximum cycle mean of edge weight of an
+     * MCMgraph using Young-Tarjan-Orlin's algorithm. The memory of the
+     * workspace w is reused and a critical cycle is stored in it.
+     */
+    CDouble maxCycleMeanYoungTarjanOrlin(MCMgraph *mcmGraph, YTOworkspace &w)
+    {
+        return 1.0 / minCycleRatioYTO(mcmGraph, w, constOne, getWeight);
+    }
 
-        // Cleanup
-        free(ytoGraph.nodes);
-        free(ytoGraph.arcs);
+    /**
+     * maxCycleMeanAndCriticalCycleYoungTarjanOrlin ()
+     * The function computes the maximum cycle mean of edge weight of
+     * an MCMgraph using Young-Tarjan-Orlin's algorithm.
+     * It returns both the MCM and a critical cycle
+     * The critical cycle is only returned if cycle and len are not NULL. Then *cycle points
+     * to an array of *MCMEdges of the critical cycle and *len indicates the length of the cycle.
+     * *cycle is a freshly allocated array and it is the caller's obligation to deallocate it
+     * in due time.
+     */
+    CDouble maxCycleMeanAndCriticalCycleYoungTarjanOrlin(MCMgraph *mcmGraph, MCMedge *** cycle, uint *len)
+    {
+        YTOworkspace &w = defaultYTOworkspace();
+        CDouble mcm;
+
+        mcm = maxCycleMeanYoungTarjanOrlin(mcmGraph, w);
 
-        return 1.0 / mincr;
+        if (cycle != NULL && len != NULL)
+            copyCriticalCycle(w, cycle, len);
+
+        return mcm;
     }
 
     /**
@@ -882,7 +997,27 @@ namespace SDF
 
     CDouble maxCycleMeanYoungTarjanOrlin(MCMgraph *mcmGraph)
     {
-        return maxCycleMeanAndCriticalCycleYoungTarjanOrlin(mcmGraph, NULL, NULL);
+        return maxCycleMeanYoungTarjanOrlin(mcmGraph, defaultYTOworkspace());
+    }
+
+    /**
+     * maxCycleRatioYoungTarjanOrlin ()
+     * The function computes the maximum cycle ratio of edge weight over delay
+     * of an MCMgraph using Young-Tarjan-Orlin's algorithm. The memory of the
+     * workspace w is reused and a critical cycle is stored in it.
+     */
+    CDouble maxCycleRatioYoungTarjanOrlin(MCMgraph *mcmGraph, YTOworkspace &w)
+    {
+        CDouble mcr;
+
+        mcr = 1.0 / minCycleRatioYTO(mcmGraph, w, getDelay, getWeight);
+
+        // note that mmcycle returns the critical cycle following edges backwards
+        // therefore reverse the order of the edges.
+        std::reverse(w.getStorage().criticalCycle.begin(),
+                     w.getStorage().criticalCycle.end());
+
+        return mcr;
     }
 
     /**
@@ -899,47 +1034,15 @@ namespace SDF
 
     CDouble maxCycleRatioAndCriticalCycleYoungTarjanOrlin(MCMgraph *mcmGraph, MCMedge *** cycle, uint *len)
     {
-        double mincr;
-        graph ytoGraph;
-        arc **ytoCycle;
-        long ytoCycLen;
+        YTOworkspace &w = defaultYTOworkspace();
+        CDouble mcr;
 
-        // Convert the graph to an input graph for the YTO algorithm
-        convertMCMgraphToYTOgraph(mcmGraph, &ytoGraph, getDelay, getWeight);
+        mcr = maxCycleRatioYoungTarjanOrlin(mcmGraph, w);
 
         if (cycle != NULL && len != NULL)
-        {
-            // allocate space for the critical cycle
-            ytoCycle = (arc **) malloc(sizeof(arc *) * mcmGraph->nrVisibleEdges());
-
-            // Find maximum cycle mean
-            mmcycle(&ytoGraph, &mincr, ytoCycle, &ytoCycLen);
-
-            *len = ytoCycLen;
-
-            *cycle = (MCMedge **) malloc(sizeof(MCMedge *) * (*len));
-
-            // note that mmcycle returns the critical cycle following edges backwards
-            // therefore reverse the order of the edges.
-            for (uint i = 0; i < *len; i++)
-            {
-                (*cycle)[i] = ytoCycle[(*len) - 1 - i]->mcmEdge;
-            }
+            copyCriticalCycle(w, cycle, len);
 
-            free(ytoCycle);
-
-        }
-        else
-        {
-            // Find maximum cycle mean without cycle
-            mmcycle(&ytoGraph, &mincr, NULL, NULL);
-        }
-
-        // Cleanup
-        free(ytoGraph.nodes);
-        free(ytoGraph.arcs);
-
-        return 1.0 / mincr;
+        return mcr;
     }
 
     /**
@@ -950,7 +1053,18 @@ namespace SDF
 
     CDouble maxCycleRatioYoungTarjanOrlin(MCMgraph *mcmGraph)
     {
-        return maxCycleRatioAndCriticalCycleYoungTarjanOrlin(mcmGraph, NULL, NULL);
+        return maxCycleRatioYoungTarjanOrlin(mcmGraph, defaultYTOworkspace());
+    }
+
+    /**
+     * minCycleRatioYoungTarjanOrlin ()
+     * The function computes the minimum cycle ratio of edge weight over delay
+     * of an MCMgraph using Young-Tarjan-Orlin's algorithm. The memory of the
+     * workspace w is reused and a critical cycle is stored in it.
+     */
+    CDouble minCycleRatioYoungTarjanOrlin(MCMgraph *mcmGraph, YTOworkspace &w)
+    {
+        return minCycleRatioYTO(mcmGraph, w, getWeight, getDelay);
     }
 
     /**
@@ -966,45 +1080,15 @@ namespace SDF
 
     CDouble minCycleRatioAndCriticalCycleYoungTarjanOrlin(MCMgraph *mcmGraph, MCMedge *** cycle, uint *len)
     {
-        double mincr;
-        graph ytoGraph;
-        arc **ytoCycle;
-        long ytoCycLen;
+        YTOworkspace &w = defaultYTOworkspace();
+        CDouble mcr;
 
-        // Convert the graph to an input graph for the YTO algorithm
-        convertMCMgraphToYTOgraph(mcmGraph, &ytoGraph, getWeight, getDelay);
+        mcr = minCycleRatioYoungTarjanOrlin(mcmGraph, w);
 
         if (cycle != NULL && len != NULL)
-        {
-            // allocate space for the critical cycle
-            ytoCycle = (arc **) malloc(sizeof(arc *) * mcmGraph->nrVisibleEdges());
-
-            // Find minimum cycle ratio
-            mmcycle(&ytoGraph, &mincr, ytoCycle, &ytoCycLen);
+            copyCriticalCycle(w, cycle, len);
 
-            *len = ytoCycLen;
-
-            *cycle = (MCMedge **) malloc(sizeof(MCMedge *) * (*len));
-
-            for (uint i = 0; i < *len; i++)
-            {
-                (*cycle)[i] = ytoCycle[i]->mcmEdge;
-            }
-
-            free(ytoCycle);
-
-        }
-        else
-        {
-            // Find minimum cycle ratio without cycle
-            mmcycle(&ytoGraph, &mincr, NULL, NULL);
-        }
-
-        // Cleanup
-        free(ytoGraph.nodes);
-        free(ytoGraph.arcs);
-
-        return mincr;
+        return mcr;
     }
 
     /**
@@ -1015,44 +1099,131 @@ namespace SDF
 
     CDouble minCycleRatioYoungTarjanOrlin(MCMgraph *mcmGraph)
     {
-        return minCycleRatioAndCriticalCycleYoungTarjanOrlin(mcmGraph, NULL, NULL);
+        return minCycleRatioYoungTarjanOrlin(mcmGraph, defaultYTOworkspace());
+    }
+
+    /**
+     * YTOcomponentSearch
+     * The strongly connected components of an MCMgraph which are analyzed
+     * concurrently. Each thread takes the next component which has not been
+     * analyzed yet.
+     */
+    typedef struct _YTOcomponentSearch
+    {
+        // Components and their minimum cycle ratio
+        vector<MCMgraph *> components;
+        vector<CDouble> ratio;
+
+        // Index of the next component to analyze
+        std::atomic<uint> next;
+
+        // Error raised by one of the threads
+        std::mutex lock;
+        CString error;
+    } YTOcomponentSearch;
+
+    /**
+     * analyzeYTOcomponents ()
+     * The function computes the minimum cycle ratio of delay over weight of
+     * the components in the search till all components have been taken.
+     */
+    static
+    void analyzeYTOcomponents(YTOcomponentSearch *search)
+    {
+        YTOworkspace &w = defaultYTOworkspace();
+        uint c;
+
+        try
+        {
+            while ((c = search->next++) < search->ratio.size())
+            {
+                search->ratio[c] = minCycleRatioYTO(search->components[c], w,
+                                                    getDelay, getWeight);
+            }
+        }
+        catch (CException &e)
+        {
+            std::lock_guard<std::mutex> guard(search->lock);
+            search->error = e.getMessage();
+        }
     }
 
     /**
      * mcmYoungTarjanOrlin ()
      * The function computes the maximum cycle mean of a HSDF graph using
-     * Young-Tarjan-Orlin's algorithm.
+     * Young-Tarjan-Orlin's algorithm. The strongly connected components of
+     * the graph are analyzed by nrThreads threads.
      */
     static
-    CDouble mcmYoungTarjanOrlin(TimedSDFgraph *g, bool mcmFormulation)
+    CDouble mcmYoungTarjanOrlin(TimedSDFgraph *g, bool mcmFormulation,
+                                const uint nrThreads)
     {
-        CDouble mcm;
+        YTOcomponentSearch search;
+        vector<std::thread> threads;
         MCMgraphs components;
         MCMgraph *mcmGraph;
-        graph ytoGraph;
+        CDouble mcm;
 
         // Transform the HSDF to a weighted directed graph
         mcmGraph = transformHSDFtoMCMgraph(g, mcmFormulation);
 
-        // Extract the strongly connected component from the graph
-        // According to the Max-Plus book there is exactly one strongly
-        // connected component in the graph when starting from a strongly
-        // connected (H)SDF graph.
+        // Extract the strongly connected components from the graph. Only
+        // these components contain cycles.
         stronglyConnectedMCMgraph(mcmGraph, components);
 
-        // Remove all hidden edges and nodes from the graph and assign new id's
-        relabelMCMgraph(mcmGraph);
+        // Graph without cycles
+        if (components.empty())
+        {
+            // Remove all hidden edges and nodes from the graph and assign new id's
+            relabelMCMgraph(mcmGraph);
 
-        // Convert the graph to an input graph for the YTO algorithm
-        convertMCMgraphToYTOgraph(mcmGraph, &ytoGraph, getDelay, getWeight);
+            mcm = minCycleRatioYTO(mcmGraph, defaultYTOworkspace(),
+                                   getDelay, getWeight);
+            delete mcmGraph;
 
-        // Find maximum cycle mean
-        mmcycle(&ytoGraph, &mcm, NULL, NULL);
+            return mcm;
+        }
+
+        // Assign new id's to the nodes of each component
+        for (MCMgraphsIter iter = components.begin();
+             iter != components.end(); iter++)
+        {
+            relabelMCMgraph(*iter);
+            search.components.push_back(*iter);
+        }
+        search.ratio.resize(search.components.size());
+        search.next = 0;
+
+        // Analyze the components
+        if (nrThreads <= 1 || search.components.size() == 1)
+        {
+            analyzeYTOcomponents(&search);
+        }
+        else
+        {
+            for (uint i = 0; i < nrThreads && i < search.components.size(); i++)
+                threads.push_back(std::thread(analyzeYTOcomponents, &search));
+
+            for (uint i = 0; i < threads.size(); i++)
+                threads[i].join();
+        }
 
         // Cleanup
+        for (MCMgraphsIter iter = components.begin();
+             iter != components.end(); iter++)
+        {
+            delete *iter;
+        }
         delete mcmGraph;
-        free(ytoGraph.nodes);
-        free(ytoGraph.arcs);
+
+        if (!search.error.empty())
+            throw CException(search.error);
+
+        // The minimum ratio of delay over weight over all components is the
+        // inverse of the maximum cycle mean over all components
+        mcm = search.ratio[0];
+        for (uint c = 1; c < search.ratio.size(); c++)
+            mcm = MIN(mcm, search.ratio[c]);
 
         return mcm;
     }
@@ -1060,9 +1231,12 @@ namespace SDF
     /**
      * maximumCycleMeanYoungTarjanOrlin ()
      * The function computes the maximum cycle mean of a HSDF graph using
-     * Young-Tarjan-Orlin's algorithm.
+     * Young-Tarjan-Orlin's algorithm. The graph does not need to be strongly
+     * connected. Its strongly connected components are analyzed by nrThreads
+     * threads.
      */
-    CDouble maximumCycleYoungTarjanOrlin(TimedSDFgraph *g, bool mcmFormulation)
+    CDouble maximumCycleYoungTarjanOrlin(TimedSDFgraph *g, bool mcmFormulation,
+                                         const uint nrThreads)
     {
         CDouble mcmGraph;
 
@@ -1070,13 +1244,47 @@ namespace SDF
         if (!isHSDFgraph(g))
             throw CException("Graph is not an HSDF graph.");
 
-        // Check that the graph g is a strongly connected graph
-        if (!isStronglyConnectedGraph(g))
-            throw CException("Graph is not strongly connected.");
-
-        mcmGraph = mcmYoungTarjanOrlin(g, mcmFormulation);
+        mcmGraph = mcmYoungTarjanOrlin(g, mcmFormulation, nrThreads);
 
         return mcmGraph;
     }
 
-}//namespace SDF
\ No newline at end of file
+    /**
+     * maximumCycleMeanSDFYoungTarjanOrlin ()
+     * The function computes the maximum cycle mean of an SDF graph using
+     * Young-Tarjan-Orlin's algorithm on the graph with one node per initial
+     * token (see transformSDFtoMCMgraph). The graph is not converted to an HSDF
+     * graph. The cycle mean of a cycle in this graph is its weight divided by
+     * its number of edges, so the maximum is found as the minimum cycle ratio of
+     * the negated weights over the delays (which are one on every edge).
+     */
+    CDouble maximumCycleMeanSDFYoungTarjanOrlin(TimedSDFgraph *g)
+    {
+        YTOworkspace w;
+        MCMgraphs components;
+        MCMgraph *mcmGraph;
+        CDouble mcm = 0;
+
+        // Transform the SDF graph to a weighted directed graph
+        mcmGraph = transformSDFtoMCMgraph(g);
+
+        // Only the strongly connected components contain cycles
+        stronglyConnectedMCMgraph(mcmGraph, components);
+
+        for (MCMgraphsIter iter = components.begin();
+             iter != components.end(); iter++)
+        {
+            MCMgraph *c = *iter;
+
+            relabelMCMgraph(c);
+            mcm = MAX(mcm, -minCycleRatioYTO(c, w, getNegatedWeight, getDelay));
+
+            delete c;
+        }
+
+        delete mcmGraph;
+
+        return mcm;
+    }
+
+}//namespace SDF
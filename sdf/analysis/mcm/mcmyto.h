@@ -44,6 +44,42 @@
 #include "mcmgraph.h"
 namespace SDF
 {
+    struct YTOstorage;
+
+    /**
+     * YTOworkspace
+     * The memory used by Young-Tarjan-Orlin's algorithm. A workspace can be
+     * reused for a series of graphs, so that memory is only allocated when a
+     * graph is larger than the graphs analyzed before. After an analysis, the
+     * workspace holds a critical cycle of the graph. A workspace must not be
+     * used by two threads at the same time.
+     */
+    class YTOworkspace
+    {
+        public:
+            // Constructor
+            YTOworkspace();
+
+            // Destructor
+            ~YTOworkspace();
+
+            // Critical cycle found by the last analysis
+            const vector<MCMedge *> &getCriticalCycle() const;
+
+            // Memory used by the algorithm
+            YTOstorage &getStorage()
+            {
+                return *storage;
+            };
+
+        private:
+            // A workspace cannot be copied
+            YTOworkspace(const YTOworkspace &w);
+            YTOworkspace &operator=(const YTOworkspace &w);
+
+            YTOstorage *storage;
+    };
+
     /**
      * mcmYoungTarjanOrlin ()
      * The function computes the maximum cycle mean of edge weight per edge of
@@ -51,6 +87,14 @@ namespace SDF
      */
     CDouble maxCycleMeanYoungTarjanOrlin(MCMgraph *mcmGraph);
 
+    /**
+     * maxCycleMeanYoungTarjanOrlin ()
+     * The function computes the maximum cycle mean of edge weight of an
+     * MCMgraph using Young-Tarjan-Orlin's algorithm. The memory of the
+     * workspace w is reused and a critical cycle is stored in it.
+     */
+    CDouble maxCycleMeanYoungTarjanOrlin(MCMgraph *mcmGraph, YTOworkspace &w);
+
     /**
      * maxCycleMeanAndCriticalCycleYoungTarjanOrlin ()
      * The function computes the maximum cycle mean of edge weight of
@@ -70,6 +114,14 @@ namespace SDF
      */
     CDouble maxCycleRatioYoungTarjanOrlin(MCMgraph *mcmGraph);
 
+    /**
+     * maxCycleRatioYoungTarjanOrlin ()
+     * The function computes the maximum cycle ratio of edge weight over delay
+     * of an MCMgraph using Young-Tarjan-Orlin's algorithm. The memory of the
+     * workspace w is reused and a critical cycle is stored in it.
+     */
+    CDouble maxCycleRatioYoungTarjanOrlin(MCMgraph *mcmGraph, YTOworkspace &w);
+
     /**
      * maxCycleRatioAndCriticalCycleYoungTarjanOrlin ()
      * The function computes the maximum cycle ratio of edge weight over delay of
@@ -90,6 +142,14 @@ namespace SDF
      */
     CDouble minCycleRatioYoungTarjanOrlin(MCMgraph *mcmGraph);
 
+    /**
+     * minCycleRatioYoungTarjanOrlin ()
+     * The function computes the minimum cycle ratio of edge weight over delay
+     * of an MCMgraph using Young-Tarjan-Orlin's algorithm. The memory of the
+     * workspace w is reused and a critical cycle is stored in it.
+     */
+    CDouble minCycleRatioYoungTarjanOrlin(MCMgraph *mcmGraph, YTOworkspace &w);
+
     /**
      * minCycleRatioAndCriticalCycleYoungTarjanOrlin ()
      * The function computes the minimum cycle ratio of edge weight over delay of
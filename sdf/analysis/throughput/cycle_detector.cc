@@ -0,0 +1,90 @@
+/*
+ *  TU Eindhoven
+ *  Eindhoven, The Netherlands
+ *
+ *  Name            :   cycle_detector.cc
+ *
+ *  Author          :   agent (agent@local)
+ *
+ *  Date            :   October 19, 2026
+ *
+ *  Function        :   Recurrent-state detection with constant memory
+ *
+ *  History         :
+ *      19-10-26    :   Initial version.
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, 59 Temple Place - Suite 330, Boston, MA 02111-1307, USA.
+ *
+ * In other words, you are welcome to use, share and improve this program.
+ * You are forbidden to forbid anyone else to use, share and improve
+ * what you give them.   Happy coding!
+ */
+
+
+#include "cycle_detector.h"
+
+namespace SDF
+{
+    /**
+     * clear ()
+     * The function forgets all visited states.
+     */
+    void SDFstateSpaceCycleDetector::clear()
+    {
+        tortoise.clear();
+        hasTortoise = false;
+        length = 0;
+        power = 1;
+        time = 0;
+    }
+
+    /**
+     * visit ()
+     * The function compares the state with the tortoise. It returns true when
+     * both states are equal. The cycle then consists of the states visited
+     * since the tortoise (excluding the tortoise and including state). The
+     * tortoise is moved to the visited state whenever the number of states
+     * visited since the last move reaches the next power of two.
+     */
+    bool SDFstateSpaceCycleDetector::visit(const vector<unsigned long long> &state,
+                                           const unsigned long long clk)
+    {
+        // First state of the sequence
+        if (!hasTortoise)
+        {
+            tortoise = state;
+            hasTortoise = true;
+            return false;
+        }
+
+        length++;
+        time += clk;
+
+        // Recurrent state found?
+        if (state == tortoise)
+            return true;
+
+        // Move the tortoise
+        if (length == power)
+        {
+            tortoise = state;
+            power = 2 * power;
+            length = 0;
+            time = 0;
+        }
+
+        return false;
+    }
+
+}//namespace SDF
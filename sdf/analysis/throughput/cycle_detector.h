@@ -0,0 +1,103 @@
+/*
+ *  TU Eindhoven
+ *  Eindhoven, The Netherlands
+ *
+ *  Name            :   cycle_detector.h
+ *
+ *  Author          :   agent (agent@local)
+ *
+ *  Date            :   October 19, 2026
+ *
+ *  Function        :   Recurrent-state detection with constant memory
+ *
+ *  History         :
+ *      19-10-26    :   Initial version.
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, 59 Temple Place - Suite 330, Boston, MA 02111-1307, USA.
+ *
+ * In other words, you are welcome to use, share and improve this program.
+ * You are forbidden to forbid anyone else to use, share and improve
+ * what you give them.   Happy coding!
+ */
+
+
+#ifndef SDF_ANALYSIS_STATESPACE_CYCLE_DETECTOR_H_INCLUDED
+#define SDF_ANALYSIS_STATESPACE_CYCLE_DETECTOR_H_INCLUDED
+
+#include "../../base/timed/graph.h"
+
+namespace SDF
+{
+    /**
+     * SDFstateSpaceCycleDetector
+     * Detects the recurrent state of a deterministic state-space exploration
+     * using Brent's algorithm. The states are visited one after the other as a
+     * sequence of words (e.g. the states at the iteration boundaries of the
+     * output actor). Only one earlier state (the tortoise) is kept. When the
+     * visited state equals this state, the states visited since the tortoise
+     * form exactly one period of the periodic phase. The detector visits at
+     * most three times as many states as an exploration which stores all
+     * states.
+     */
+    class SDFstateSpaceCycleDetector
+    {
+        public:
+            // Constructor
+            SDFstateSpaceCycleDetector()
+            {
+                clear();
+            };
+
+            // Destructor
+            ~SDFstateSpaceCycleDetector() {};
+
+            // Forget all visited states
+            void clear();
+
+            // Visit the next state (returns true when a cycle is found)
+            bool visit(const vector<unsigned long long> &state,
+                       const unsigned long long clk);
+
+            // Number of states and sum of their clock values on the cycle
+            unsigned long long getCycleLength() const
+            {
+                return length;
+            };
+            unsigned long long getCycleTime() const
+            {
+                return time;
+            };
+
+            // Average number of states per time unit on the cycle
+            TDtime computeThroughput() const
+            {
+                return (TDtime)(length) / (TDtime)(time);
+            };
+
+        private:
+            // State against which the visited states are compared
+            vector<unsigned long long> tortoise;
+            bool hasTortoise;
+
+            // Number of states visited since the tortoise was moved and the
+            // number of states after which the tortoise is moved again
+            unsigned long long length;
+            unsigned long long power;
+
+            // Sum of the clock values of the states visited since the tortoise
+            // was moved
+            unsigned long long time;
+    };
+}//namespace SDF
+#endif
@@ -0,0 +1,227 @@
+/*
+ *  TU Eindhoven
+ *  Eindhoven, The Netherlands
+ *
+ *  Name            :   event_queue.cc
+ *
+ *  Author          :   agent (agent@local)
+ *
+ *  Date            :   October 19, 2026
+ *
+ *  Function        :   Event-driven clock advancement for state-space analysis
+ *
+ *  History         :
+ *      19-10-26    :   Initial version.
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, 59 Temple Place - Suite 330, Boston, MA 02111-1307, USA.
+ *
+ * In other words, you are welcome to use, share and improve this program.
+ * You are forbidden to forbid anyone else to use, share and improve
+ * what you give them.   Happy coding!
+ */
+
+
+#include "event_queue.h"
+#include <algorithm>
+
+namespace SDF
+{
+    /**
+     * init ()
+     * The function binds the event queue to the graph g. The order of the actors
+     * in the actor list of g is used to order simultaneous events.
+     */
+    void SDFstateSpaceEventQueue::init(SDFGraph *g)
+    {
+        actors.clear();
+        position.resize(g->nrActors());
+
+        for (SDFactorsIter iter = g->actorsBegin(); iter != g->actorsEnd(); iter++)
+        {
+            SDFactor *a = *iter;
+
+            position[a->getId()] = (uint)actors.size();
+            actors.push_back(a);
+        }
+
+        firings.resize(g->nrActors());
+        scheduled.resize(g->nrActors());
+        candidate.resize(g->nrActors());
+
+        clear();
+    }
+
+    /**
+     * clear ()
+     * The function removes all active firings and resets the time to zero. All
+     * actors are marked as candidate to fire.
+     */
+    void SDFstateSpaceEventQueue::clear()
+    {
+        now = 0;
+
+        while (!events.empty())
+            events.pop();
+
+        ending.clear();
+        candidates.clear();
+
+        for (uint i = 0; i < actors.size(); i++)
+        {
+            firings[i].clear();
+            scheduled[i] = false;
+            candidate[i] = false;
+        }
+
+        for (uint i = 0; i < actors.size(); i++)
+            markCandidate(actors[i]);
+    }
+
+    /**
+     * startFiring ()
+     * The function adds a firing of actor a which completes duration time units
+     * from now. Firings of an actor complete in the order in which they start.
+     */
+    void SDFstateSpaceEventQueue::startFiring(SDFactor *a, const SDFtime duration)
+    {
+        CId id = a->getId();
+
+        firings[id].push_back(now + duration);
+
+        // First firing of the actor?
+        if (!scheduled[id] && firings[id].size() == 1)
+        {
+            events.push(Event(firings[id].front(), position[id]));
+            scheduled[id] = true;
+        }
+    }
+
+    /**
+     * rescheduleEndedActors ()
+     * The actors which ended a firing since the last call to actorsEndingNow are
+     * not in the heap. Their (new) first firing is inserted again.
+     */
+    void SDFstateSpaceEventQueue::rescheduleEndedActors()
+    {
+        for (vector<SDFactor *>::iterator iter = ending.begin();
+             iter != ending.end(); iter++)
+        {
+            CId id = (*iter)->getId();
+
+            if (!scheduled[id] && !firings[id].empty())
+            {
+                events.push(Event(firings[id].front(), position[id]));
+                scheduled[id] = true;
+            }
+        }
+
+        ending.clear();
+    }
+
+    /**
+     * actorsEndingNow ()
+     * The function returns all actors whose first firing completes at the
+     * current time. The actors are returned in the order of the actor list. The
+     * caller must end these firings before the clock is advanced.
+     */
+    const vector<SDFactor *> &SDFstateSpaceEventQueue::actorsEndingNow()
+    {
+        rescheduleEndedActors();
+
+        while (!events.empty() && events.top().first == now)
+        {
+            SDFactor *a = actors[events.top().second];
+
+            events.pop();
+            scheduled[a->getId()] = false;
+            ending.push_back(a);
+        }
+
+        return ending;
+    }
+
+    /**
+     * clockStep ()
+     * The function progresses time till the first end of firing transition
+     * becomes enabled. The time step is returned. In case of deadlock, the
+     * time step is equal to UINT_MAX.
+     */
+    SDFtime SDFstateSpaceEventQueue::clockStep()
+    {
+        SDFtime step;
+
+        rescheduleEndedActors();
+
+        // Check for progress (i.e. no deadlock)
+        if (events.empty())
+            return UINT_MAX;
+
+        step = (SDFtime)(events.top().first - now);
+        now = events.top().first;
+
+        return step;
+    }
+
+    /**
+     * readyCandidates ()
+     * The function returns all actors that may have become enabled since the
+     * previous call (in the order of the actor list). The ready set is cleared.
+     */
+    const vector<SDFactor *> &SDFstateSpaceEventQueue::readyCandidates()
+    {
+        order.clear();
+
+        for (vector<SDFactor *>::iterator iter = candidates.begin();
+             iter != candidates.end(); iter++)
+        {
+            candidate[(*iter)->getId()] = false;
+            order.push_back(position[(*iter)->getId()]);
+        }
+        candidates.clear();
+
+        // Order actors as in the actor list
+        std::sort(order.begin(), order.end());
+
+        scan.clear();
+        for (uint i = 0; i < order.size(); i++)
+            scan.push_back(actors[order[i]]);
+
+        return scan;
+    }
+
+    /**
+     * getRemainingTimes ()
+     * The function stores the remaining execution time of all active firings of
+     * every actor in actClk.
+     */
+    void SDFstateSpaceEventQueue::getRemainingTimes(
+        vector< list<SDFtime> > &actClk) const
+    {
+        for (uint i = 0; i < firings.size(); i++)
+        {
+            list<SDFtime>::iterator clk;
+
+            // Re-use the elements already in the list
+            actClk[i].resize(firings[i].size());
+            clk = actClk[i].begin();
+
+            for (std::deque<unsigned long long>::const_iterator
+                 iter = firings[i].begin(); iter != firings[i].end(); iter++)
+            {
+                *clk = (SDFtime)(*iter - now);
+                clk++;
+            }
+        }
+    }
+}//namespace SDF
@@ -0,0 +1,147 @@
+/*
+ *  TU Eindhoven
+ *  Eindhoven, The Netherlands
+ *
+ *  Name            :   event_queue.h
+ *
+ *  Author          :   agent (agent@local)
+ *
+ *  Date            :   October 19, 2026
+ *
+ *  Function        :   Event-driven clock advancement for state-space analysis
+ *
+ *  History         :
+ *      19-10-26    :   Initial version.
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, 59 Temple Place - Suite 330, Boston, MA 02111-1307, USA.
+ *
+ * In other words, you are welcome to use, share and improve this program.
+ * You are forbidden to forbid anyone else to use, share and improve
+ * what you give them.   Happy coding!
+ */
+
+#ifndef SDF_ANALYSIS_STATESPACE_EVENT_QUEUE_H_INCLUDED
+#define SDF_ANALYSIS_STATESPACE_EVENT_QUEUE_H_INCLUDED
+
+#include "../../base/timed/graph.h"
+#include <deque>
+#include <functional>
+#include <queue>
+#include <utility>
+
+namespace SDF
+{
+    /**
+     * SDFstateSpaceEventQueue
+     * Event-driven execution engine shared by the state-space transition
+     * systems. Actor firings are stored with their absolute completion time.
+     * The head firing of every active actor is kept in a min-heap, so advancing
+     * the clock never touches the other firings. Actors which may have become
+     * enabled (i.e. actors adjacent to a channel whose contents changed) are
+     * collected in a ready set. Ties are broken on the position of the actor in
+     * the actor list of the graph. As a result, the sequence of states visited
+     * is identical to the sequence visited when scanning all actors.
+     */
+    class SDFstateSpaceEventQueue
+    {
+        public:
+            // Constructor
+            SDFstateSpaceEventQueue()
+            {
+                now = 0;
+            };
+
+            // Destructor
+            ~SDFstateSpaceEventQueue() {};
+
+            // Bind the queue to a graph
+            void init(SDFGraph *g);
+
+            // Remove all firings, reset time and mark all actors as candidate
+            void clear();
+
+            // Current (absolute) time
+            unsigned long long getTime() const
+            {
+                return now;
+            };
+
+            // Firings
+            void startFiring(SDFactor *a, const SDFtime duration);
+            bool firingEnds(SDFactor *a) const
+            {
+                const std::deque<unsigned long long> &f = firings[a->getId()];
+
+                return !f.empty() && f.front() == now;
+            };
+            void endFiring(SDFactor *a)
+            {
+                firings[a->getId()].pop_front();
+            };
+
+            // Actors whose first firing completes at the current time (in the
+            // order of the actor list)
+            const vector<SDFactor *> &actorsEndingNow();
+
+            // Progress time till the first end of firing becomes enabled
+            SDFtime clockStep();
+
+            // Ready set
+            void markCandidate(SDFactor *a)
+            {
+                if (!candidate[a->getId()])
+                {
+                    candidate[a->getId()] = true;
+                    candidates.push_back(a);
+                }
+            };
+            const vector<SDFactor *> &readyCandidates();
+
+            // Remaining execution time of all active firings
+            void getRemainingTimes(vector< list<SDFtime> > &actClk) const;
+
+        private:
+            // Head firing of an actor (completion time, position in actor list)
+            typedef std::pair<unsigned long long, uint> Event;
+            typedef std::priority_queue<Event, vector<Event>,
+                    std::greater<Event> > Events;
+
+            // Re-insert the actors which ended a firing into the heap
+            void rescheduleEndedActors();
+
+            // Actors in the order of the actor list and position of each actor
+            vector<SDFactor *> actors;
+            vector<uint> position;
+
+            // Active firings of every actor (absolute completion times)
+            vector< std::deque<unsigned long long> > firings;
+
+            // Heap with the first firing of every actor with a firing
+            Events events;
+            vector<bool> scheduled;
+
+            // Actors returned by the last call to actorsEndingNow
+            vector<SDFactor *> ending;
+
+            // Ready set
+            vector<SDFactor *> candidates;
+            vector<SDFactor *> scan;
+            vector<uint> order;
+            vector<bool> candidate;
+
+            // Current time
+            unsigned long long now;
+    };
+}//namespace SDF
+#endif
@@ -94,6 +94,31 @@ namespace SDF
         glbClk = 0;
     }
 
+    /**
+     * pack ()
+     * The function stores the words which identify the state in words. Two
+     * states are equal when their words are equal.
+     */
+    void SDFstateSpaceThroughputAnalysis::TransitionSystem::State::pack(
+        vector<unsigned long long> &words) const
+    {
+        words.clear();
+        words.push_back(glbClk);
+
+        for (uint i = 0; i < ch.size(); i++)
+            words.push_back(ch[i]);
+
+        for (uint i = 0; i < actClk.size(); i++)
+        {
+            words.push_back(actClk[i].size());
+            for (list<SDFtime>::const_iterator iter = actClk[i].begin();
+                 iter != actClk[i].end(); iter++)
+            {
+                words.push_back(*iter);
+            }
+        }
+    }
+
     /**
      * operator== ()
      * The function compares to states and returns true if they are equal.
@@ -138,8 +163,12 @@ namespace SDF
         repVec = computeRepetitionVector(g);
 
         // Select actor with lowest entry in repetition vector as output actor
+        // (actors mirrored by another actor are not executed)
         for (SDFactorsIter iter = g->actorsBegin(); iter != g->actorsEnd(); iter++)
         {
+            if (symmetry.isMirrored(*iter))
+                continue;
+
             if (repVec[(*iter)->getId()] < min)
             {
                 a = *iter;
@@ -154,36 +183,18 @@ namespace SDF
 
     /**
      * storeState ()
-     * The function stores the state s on whenever s is not already in the
-     * list of storedStates. When s is stored, the function returns true. When the
-     * state s is already in the list, the state s is not stored. The function
-     * returns false. The function always sets the pos variable to the position
-     * where the state s is in the list.
+     * The function stores the state s whenever s is not already in the set of
+     * storedStates. When s is stored, the function returns true. When the
+     * state s is already stored, the function returns false. The function
+     * always sets the pos variable to the position of the state s in the
+     * stored states.
      */
     bool SDFstateSpaceThroughputAnalysis::TransitionSystem::storeState(State &s,
-            StatesIter &pos)
+            SDFstateSpaceStateStore::Index &pos)
     {
-        // Find state in the list of stored states
-        for (StatesIter iter = storedStates.begin();
-             iter != storedStates.end(); iter++)
-        {
-            State &x = *iter;
-
-            // State s at position iter in the list?
-            if (x == s)
-            {
-                pos = iter;
-                return false;
-            }
-        }
-
-        // State not found, store it at the end of the list
-        storedStates.push_back(s);
+        s.pack(packedState);
 
-        // Added state to the end of the list
-        pos = storedStates.end();
-
-        return true;
+        return storedStates.store(packedState, s.glbClk, pos);
     }
 
     /**
@@ -192,22 +203,21 @@ namespace SDF
      * value is equal to the average number of firings of an actor per time unit.
      */
     TDtime SDFstateSpaceThroughputAnalysis::TransitionSystem::computeThroughput(
-        const StatesIter cycleIter)
+        const SDFstateSpaceStateStore::Index cycleStart)
     {
         int nr_fire = 0;
         TDtime time = 0;
 
         // Check all state from stack till cycle complete
-        for (StatesIter iter = cycleIter; iter != storedStates.end(); iter++)
+        for (SDFstateSpaceStateStore::Index i = cycleStart;
+             i < storedStates.size(); i++)
         {
-            State &s = *iter;
-
             // Number of states in cycle is equal to number of iterations
             // in the period
             nr_fire++;
 
             // Time between previous state
-            time += s.glbClk;
+            time += storedStates.getClk(i);
         }
 
         return (TDtime)(nr_fire) / (time);
@@ -222,8 +232,6 @@ namespace SDF
 #define CONSUME(c,n)        CH(c) = CH(c) - n;
 #define PRODUCE(c,n)        CH(c) = CH(c) + n;
 
-#define CH_TOKENS_PREV(c,n) (previousState.ch[c] >= n)
-
     /**
      * actorReadyToFire ()
      * The function returns true when the actor is ready to fire in state
@@ -232,12 +240,20 @@ namespace SDF
     bool SDFstateSpaceThroughputAnalysis::TransitionSystem::actorReadyToFire(
         SDFactor *a)
     {
+        // Actor mirrored by another actor?
+        if (symmetry.isMirrored(a))
+            return false;
+
         // Check all input ports for tokens
         for (SDFportsIter iter = a->portsBegin(); iter != a->portsEnd(); iter++)
         {
             SDFport *p = *iter;
             SDFchannel *c = p->getChannel();
 
+            // Channel mirrored by another channel?
+            if (symmetry.isMirrored(c))
+                continue;
+
             // Actor is destination of the channel?
             if (p->getType() == SDFport::In)
             {
@@ -266,6 +282,10 @@ namespace SDF
             SDFport *p = *iter;
             SDFchannel *c = p->getChannel();
 
+            // Channel mirrored by another channel?
+            if (symmetry.isMirrored(c))
+                continue;
+
             // Actor is destination of the channel?
             if (p->getType() == SDFport::In)
             {
@@ -274,31 +294,13 @@ namespace SDF
         }
 
         // Add actor firing to the list of active firings of this actor
-        currentState.actClk[a->getId()].push_back(a->getExecutionTime());
+        events.startFiring(a, a->getExecutionTime());
 
 #ifdef _PRINT_STATESPACE
         cout << "start: " << a->getName() << endl;
 #endif
     }
 
-    /**
-     * actorReadyToEnd ()
-     * The function returns true when the actor is ready to end its firing. Else
-     * the function returns false.
-     */
-    bool SDFstateSpaceThroughputAnalysis::TransitionSystem::actorReadyToEnd(
-        SDFactor *a)
-    {
-        if (currentState.actClk[a->getId()].empty())
-            return false;
-
-        // First actor firing in sorted list has execution time left?
-        if (currentState.actClk[a->getId()].front() != 0)
-            return false;
-
-        return true;
-    }
-
     /**
      * endActorFiring ()
      * Produce tokens on all output channels and remove the actor firing from the
@@ -312,74 +314,28 @@ namespace SDF
             SDFport *p = *iter;
             SDFchannel *c = p->getChannel();
 
+            // Channel mirrored by another channel?
+            if (symmetry.isMirrored(c))
+                continue;
+
             // Actor is source of the channel?
             if (p->getType() == SDFport::Out)
             {
                 PRODUCE(c->getId(), p->getRate());
+
+                // Destination actor may have become enabled
+                events.markCandidate(c->getDstActor());
             }
         }
 
         // Remove the firing from the list of active actor firings
-        currentState.actClk[a->getId()].pop_front();
+        events.endFiring(a);
 
 #ifdef _PRINT_STATESPACE
         cout << "end:   " << a->getName() << endl;
 #endif
     }
 
-    /**
-     * clockStep ()
-     * The function progresses time till the first end of firing transition
-     * becomes enabled. The time step is returned. In case of deadlock, the
-     * time step is equal to UINT_MAX.
-     */
-    SDFtime SDFstateSpaceThroughputAnalysis::TransitionSystem::clockStep()
-    {
-        SDFtime step = UINT_MAX;
-
-        // Find maximal time progress
-        for (uint a = 0; a < g->nrActors(); a++)
-        {
-            if (!currentState.actClk[a].empty())
-            {
-                SDFtime actClk = currentState.actClk[a].front();
-
-                if (step > actClk)
-                    step = actClk;
-            }
-        }
-
-        // Still actors ready to end their firing?
-        if (step == 0)
-            return 0;
-
-        // Check for progress (i.e. no deadlock)
-        if (step == UINT_MAX)
-            return UINT_MAX;
-
-        // Lower remaining execution time actors
-        for (uint a = 0; a < g->nrActors(); a++)
-        {
-            for (list<SDFtime>::iterator iter = currentState.actClk[a].begin();
-                 iter != currentState.actClk[a].end(); iter++)
-            {
-                SDFtime &actFiringTime = *iter;
-
-                // Lower remaining execution time of the actor firing
-                actFiringTime -= step;
-            }
-        }
-
-        // Advance the global clock
-        currentState.glbClk += step;
-
-#ifdef _PRINT_STATESPACE
-        cout << "clk:   " << step << endl;
-#endif
-
-        return step;
-    }
-
     /**
      * execSDFgraph()
      * Execute the SDF graph till a deadlock is found or a recurrent state.
@@ -387,18 +343,18 @@ namespace SDF
      */
     TDtime SDFstateSpaceThroughputAnalysis::TransitionSystem::execSDFgraph()
     {
-        StatesIter recurrentState;
+        SDFstateSpaceStateStore::Index recurrentState;
         SDFtime clkStep;
         int repCnt = 0;
 
         // Clear the list of stored states
         clearStoredStates();
+        cycleDetector.clear();
 
         // Create initial state
         currentState.init(g->nrActors(), g->nrChannels());
         currentState.clear();
-        previousState.init(g->nrActors(), g->nrChannels());
-        previousState.clear();
+        events.clear();
 
         // Initial tokens and space
         for (SDFchannelsIter iter = g->channelsBegin();
@@ -416,30 +372,42 @@ namespace SDF
         // Fire the actors
         while (true)
         {
-            // Store partial state to check for progress
-            for (uint i = 0; i < g->nrChannels(); i++)
-            {
-                previousState.ch[i] = currentState.ch[i];
-            }
-
             // Finish actor firings
-            for (SDFactorsIter iter = g->actorsBegin();
-                 iter != g->actorsEnd(); iter++)
+            const vector<SDFactor *> &ending = events.actorsEndingNow();
+            for (vector<SDFactor *>::const_iterator iter = ending.begin();
+                 iter != ending.end(); iter++)
             {
                 SDFactor *a = *iter;
 
-                while (actorReadyToEnd(a))
+                while (events.firingEnds(a))
                 {
                     if (outputActor == a->getId())
                     {
                         repCnt++;
                         if (repCnt == outputActorRepCnt)
                         {
+                            // Remaining execution times of active firings
+                            events.getRemainingTimes(currentState.actClk);
 #ifdef _PRINT_STATESPACE
                             currentState.print(cout);
 #endif
+                            // Compare state with the tortoise of the cycle
+                            // detection
+                            if (cycleDetection)
+                            {
+                                currentState.pack(packedState);
+                                if (cycleDetector.visit(packedState,
+                                                        currentState.glbClk))
+                                {
+#ifdef _PRINT_STATESPACE
+                                    cout << "### end statespace exploration";
+                                    cout << endl;
+#endif
+                                    return cycleDetector.computeThroughput();
+                                }
+                            }
                             // Add state to hash of visited states
-                            if (!storeState(currentState, recurrentState))
+                            else if (!storeState(currentState, recurrentState))
                             {
 #ifdef _PRINT_STATESPACE
                                 cout << "### end statespace exploration" << endl;
@@ -457,8 +425,9 @@ namespace SDF
             }
 
             // Start actor firings
-            for (SDFactorsIter iter = g->actorsBegin();
-                 iter != g->actorsEnd(); iter++)
+            const vector<SDFactor *> &candidates = events.readyCandidates();
+            for (vector<SDFactor *>::const_iterator iter = candidates.begin();
+                 iter != candidates.end(); iter++)
             {
                 TimedSDFactor *a = (TimedSDFactor *)(*iter);
 
@@ -471,7 +440,7 @@ namespace SDF
             }
 
             // Clock step
-            clkStep = clockStep();
+            clkStep = events.clockStep();
 
             // Deadlocked?
             if (clkStep == UINT_MAX)
@@ -481,6 +450,14 @@ namespace SDF
 #endif
                 return 0;
             }
+
+            // Advance the global clock
+            currentState.glbClk += clkStep;
+
+#ifdef _PRINT_STATESPACE
+            if (clkStep != 0)
+                cout << "clk:   " << clkStep << endl;
+#endif
         }
 
         return 0;
@@ -497,6 +474,9 @@ namespace SDF
         RepetitionVector repVec;
         TDtime thr;
 
+        thrAnalysisAlgo.setSymmetryReduction(symmetryReduction);
+        thrAnalysisAlgo.setCycleDetection(cycleDetection);
+
         // Compute repetition vector
         repVec = computeRepetitionVector(g);
 
@@ -570,7 +550,7 @@ namespace SDF
         }
 
         // Create a transition system
-        TransitionSystem transitionSystem(g);
+        TransitionSystem transitionSystem(g, symmetryReduction, cycleDetection);
 
         // Find the maximal throughput
         thr = transitionSystem.execSDFgraph();
@@ -37,6 +37,10 @@
 #define SDF_ANALYSIS_STATESPACE_SELFTIMED_THROUGHPUT_H_INCLUDED
 
 #include "../../base/timed/graph.h"
+#include "event_queue.h"
+#include "symmetry.h"
+#include "state_store.h"
+#include "cycle_detector.h"
 namespace SDF
 {
     /**
@@ -48,7 +52,11 @@ namespace SDF
     {
         public:
             // Constructor
-            SDFstateSpaceThroughputAnalysis() {};
+            SDFstateSpaceThroughputAnalysis()
+            {
+                symmetryReduction = false;
+                cycleDetection = false;
+            };
 
             // Destructor
             ~SDFstateSpaceThroughputAnalysis() {};
@@ -56,6 +64,19 @@ namespace SDF
             // Analyze throughput of the graph
             TDtime analyze(TimedSDFgraph *g);
 
+            // Execute only one block of every group of identical actors
+            void setSymmetryReduction(const bool flag)
+            {
+                symmetryReduction = flag;
+            };
+
+            // Find the recurrent state with Brent's algorithm instead of
+            // storing all visited states
+            void setCycleDetection(const bool flag)
+            {
+                cycleDetection = flag;
+            };
+
         private:
 
             /***************************************************************************
@@ -96,20 +117,25 @@ namespace SDF
                             // Output state
                             void print(ostream &out);
 
+                            // Words which identify the state
+                            void pack(vector<unsigned long long> &words) const;
+
                             // State information
                             vector< list<SDFtime> > actClk;
                             vector< TBufSize > ch;
                             unsigned long glbClk;
                     };
 
-                    // Sequence of states in transition system
-                    typedef list<State>      States;
-                    typedef States::iterator StatesIter;
-
                     // Constructor
-                    TransitionSystem(TimedSDFgraph *gr)
+                    TransitionSystem(TimedSDFgraph *gr,
+                                     const bool symmetryReduction = false,
+                                     const bool detectCycle = false)
                     {
                         g = gr;
+                        cycleDetection = detectCycle;
+                        events.init(g);
+                        if (symmetryReduction)
+                            symmetry.init(g);
                         initOutputActor();
                     };
 
@@ -121,7 +147,7 @@ namespace SDF
 
                 private:
                     // Store state
-                    bool storeState(State &s, StatesIter &pos);
+                    bool storeState(State &s, SDFstateSpaceStateStore::Index &pos);
 
                     // Clear list of stored states
                     void clearStoredStates()
@@ -130,14 +156,13 @@ namespace SDF
                     };
 
                     // Compute throughput from transition system
-                    TDtime computeThroughput(const StatesIter cycleIter);
+                    TDtime computeThroughput(
+                        const SDFstateSpaceStateStore::Index cycleStart);
 
                     // State transitions
                     bool actorReadyToFire(SDFactor *a);
                     void startActorFiring(TimedSDFactor *a);
-                    bool actorReadyToEnd(SDFactor *a);
                     void endActorFiring(SDFactor *a);
-                    SDFtime clockStep();
 
                     // Output actor
                     void initOutputActor();
@@ -147,13 +172,29 @@ namespace SDF
                     CId outputActor;
                     TCnt outputActorRepCnt;
 
-                    // Current and previous state
+                    // Current state
                     State currentState;
-                    State previousState;
 
-                    // List of visited states that are stored
-                    States storedStates;
+                    // Active actor firings and actors that may be enabled
+                    SDFstateSpaceEventQueue events;
+
+                    // Symmetries between actors
+                    SDFstateSpaceSymmetry symmetry;
+
+                    // Visited states that are stored
+                    SDFstateSpaceStateStore storedStates;
+                    vector<unsigned long long> packedState;
+
+                    // Recurrent-state detection without stored states
+                    bool cycleDetection;
+                    SDFstateSpaceCycleDetector cycleDetector;
             };
+
+            // Symmetry reduction
+            bool symmetryReduction;
+
+            // Recurrent-state detection with Brent's algorithm
+            bool cycleDetection;
     };
 }//namespace SDF
 #endif
@@ -0,0 +1,343 @@
+/*
+ *  TU Eindhoven
+ *  Eindhoven, The Netherlands
+ *
+ *  Name            :   state_store.cc
+ *
+ *  Author          :   agent (agent@local)
+ *
+ *  Date            :   October 19, 2026
+ *
+ *  Function        :   Bounded-memory store for visited states
+ *
+ *  History         :
+ *      19-10-26    :   Initial version.
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, 59 Temple Place - Suite 330, Boston, MA 02111-1307, USA.
+ *
+ * In other words, you are welcome to use, share and improve this program.
+ * You are forbidden to forbid anyone else to use, share and improve
+ * what you give them.   Happy coding!
+ */
+
+
+#include "state_store.h"
+#include <cstdlib>
+#include <cstring>
+#ifndef _MSC_VER
+#include <sys/mman.h>
+#endif
+
+namespace SDF
+{
+    /**
+     * defaultMemoryLimit
+     * Memory limit of every store which is created (0 = no limit).
+     */
+    unsigned long long SDFstateSpaceStateStore::defaultMemoryLimit = 0;
+
+    /**
+     * SDFstateSpaceStateStore ()
+     * Constructor.
+     */
+    SDFstateSpaceStateStore::SDFstateSpaceStateStore()
+    {
+        spillFile = NULL;
+        spillMap = NULL;
+        spillMapSize = 0;
+        spillOffset = 0;
+        memoryLimit = defaultMemoryLimit;
+        index.resize(1024, 0);
+    }
+
+    /**
+     * ~SDFstateSpaceStateStore ()
+     * Destructor.
+     */
+    SDFstateSpaceStateStore::~SDFstateSpaceStateStore()
+    {
+        closeSpillFile();
+    }
+
+    /**
+     * clear ()
+     * The function removes all states from the store.
+     */
+    void SDFstateSpaceStateStore::clear()
+    {
+        closeSpillFile();
+
+        index.assign(1024, 0);
+        hashes.clear();
+        offsets.clear();
+        clks.clear();
+        records.clear();
+        spillOffset = 0;
+    }
+
+    /**
+     * encode ()
+     * The function encodes the state into the record. Every word is stored
+     * using seven bits per byte. The highest bit of a byte is set when more
+     * bytes of the word follow.
+     */
+    void SDFstateSpaceStateStore::encode(const vector<unsigned long long> &state)
+    {
+        record.clear();
+
+        for (uint i = 0; i < state.size(); i++)
+        {
+            unsigned long long w = state[i];
+
+            while (w >= 0x80)
+            {
+                record.push_back((unsigned char)(w | 0x80));
+                w >>= 7;
+            }
+            record.push_back((unsigned char)w);
+        }
+    }
+
+    /**
+     * hash ()
+     * The function returns a (FNV-1a) hash value of the record.
+     */
+    unsigned int SDFstateSpaceStateStore::hash(const vector<unsigned char> &r)
+    {
+        unsigned int h = 2166136261U;
+
+        for (uint i = 0; i < r.size(); i++)
+        {
+            h ^= r[i];
+            h *= 16777619U;
+        }
+
+        return h;
+    }
+
+    /**
+     * store ()
+     * The function stores the state with global clock value clk whenever the
+     * state is not already in the store. When the state is stored, the
+     * function returns true. Otherwise, the function returns false. The
+     * function always sets pos to the position of the state in the store.
+     */
+    bool SDFstateSpaceStateStore::store(const vector<unsigned long long> &state,
+                                        const unsigned long long clk, Index &pos)
+    {
+        unsigned long long mask = index.size() - 1;
+        unsigned long long slot;
+        unsigned int h;
+
+        encode(state);
+        h = hash(record);
+
+        // Find state in the index
+        for (slot = h & mask; index[slot] != 0; slot = (slot + 1) & mask)
+        {
+            Index p = index[slot] - 1;
+
+            if (hashes[p] == h && recordEquals(p, record))
+            {
+                pos = p;
+                return false;
+            }
+        }
+
+        // State not found, store it
+        pos = clks.size();
+        index[slot] = pos + 1;
+        hashes.push_back(h);
+        offsets.push_back(spillOffset + records.size());
+        clks.push_back(clk);
+        records.insert(records.end(), record.begin(), record.end());
+
+        // Keep load of the index below one half
+        if (2 * clks.size() > index.size())
+            growIndex();
+
+        // Records in memory exceed their part of the memory limit?
+        if (memoryLimit != 0 && records.size() > recordMemoryLimit())
+            spillRecords();
+
+        return true;
+    }
+
+    /**
+     * recordMemoryLimit ()
+     * The function returns the number of bytes of records which may be kept in
+     * memory. The index and the hash value, start of the record and global
+     * clock of every state always stay in memory. They are counted toward the
+     * memory limit, so the records get the remainder of the limit. When this
+     * remainder gets small, the records may still use a sixteenth of the limit
+     * such that they are moved to the spill file in large blocks. The memory
+     * use of the store then exceeds the limit.
+     */
+    unsigned long long SDFstateSpaceStateStore::recordMemoryLimit() const
+    {
+        unsigned long long indexMemory, minRecordMemory;
+
+        indexMemory = index.size() * sizeof(Index)
+                      + clks.size() * (sizeof(unsigned int)
+                                       + 2 * sizeof(unsigned long long));
+        minRecordMemory = memoryLimit / 16;
+
+        if (indexMemory + minRecordMemory >= memoryLimit)
+            return minRecordMemory;
+
+        return memoryLimit - indexMemory;
+    }
+
+    /**
+     * growIndex ()
+     * The function doubles the size of the hash index.
+     */
+    void SDFstateSpaceStateStore::growIndex()
+    {
+        unsigned long long mask;
+
+        index.assign(2 * index.size(), 0);
+        mask = index.size() - 1;
+
+        for (Index p = 0; p < hashes.size(); p++)
+        {
+            unsigned long long slot = hashes[p] & mask;
+
+            while (index[slot] != 0)
+                slot = (slot + 1) & mask;
+            index[slot] = p + 1;
+        }
+    }
+
+    /**
+     * recordEquals ()
+     * The function returns true when the record of the state at position pos
+     * is equal to r.
+     */
+    bool SDFstateSpaceStateStore::recordEquals(const Index pos,
+            const vector<unsigned char> &r)
+    {
+        unsigned long long start = offsets[pos];
+        unsigned long long end;
+        const unsigned char *data;
+
+        if (pos + 1 < offsets.size())
+            end = offsets[pos + 1];
+        else
+            end = spillOffset + records.size();
+
+        if (end - start != r.size())
+            return false;
+
+        if (start >= spillOffset)
+            data = &records[start - spillOffset];
+        else
+            data = mapSpilledRecords() + start;
+
+        return memcmp(data, &r[0], r.size()) == 0;
+    }
+
+    /**
+     * spillRecords ()
+     * The function appends all records which are in memory to the spill file.
+     */
+    void SDFstateSpaceStateStore::spillRecords()
+    {
+        if (spillFile == NULL)
+        {
+            spillFileName = tempFileName("", "sdf3");
+            spillFile = fopen(spillFileName.c_str(), "w+b");
+            if (spillFile == NULL)
+                throw CException("Failed to create state spill file '"
+                                 + spillFileName + "'.");
+        }
+
+        if (fwrite(&records[0], 1, records.size(), spillFile) != records.size()
+            || fflush(spillFile) != 0)
+        {
+            throw CException("Failed to write state spill file '"
+                             + spillFileName + "'.");
+        }
+
+        spillOffset += records.size();
+        records.clear();
+    }
+
+    /**
+     * mapSpilledRecords ()
+     * The function returns a pointer to the records in the spill file. The
+     * mapping of the file is renewed when records have been added to the file.
+     */
+    const unsigned char *SDFstateSpaceStateStore::mapSpilledRecords()
+    {
+        if (spillMapSize == spillOffset)
+            return spillMap;
+
+#ifdef _MSC_VER
+        // Read the complete file into memory
+        spillMap = (unsigned char *)realloc(spillMap, spillOffset);
+        if (spillMap == NULL || fseek(spillFile, 0, SEEK_SET) != 0
+            || fread(spillMap, 1, spillOffset, spillFile) != spillOffset
+            || fseek(spillFile, 0, SEEK_END) != 0)
+        {
+            throw CException("Failed to read state spill file '"
+                             + spillFileName + "'.");
+        }
+#else
+        void *m;
+
+        if (spillMap != NULL)
+            munmap(spillMap, spillMapSize);
+        spillMap = NULL;
+        spillMapSize = 0;
+
+        m = mmap(NULL, spillOffset, PROT_READ, MAP_SHARED, fileno(spillFile), 0);
+        if (m == MAP_FAILED)
+        {
+            throw CException("Failed to map state spill file '"
+                             + spillFileName + "'.");
+        }
+        spillMap = (unsigned char *)m;
+#endif
+        spillMapSize = spillOffset;
+
+        return spillMap;
+    }
+
+    /**
+     * closeSpillFile ()
+     * The function unmaps, closes and removes the spill file.
+     */
+    void SDFstateSpaceStateStore::closeSpillFile()
+    {
+        if (spillMap != NULL)
+        {
+#ifdef _MSC_VER
+            free(spillMap);
+#else
+            munmap(spillMap, spillMapSize);
+#endif
+        }
+        spillMap = NULL;
+        spillMapSize = 0;
+
+        if (spillFile != NULL)
+        {
+            fclose(spillFile);
+            remove(spillFileName.c_str());
+        }
+        spillFile = NULL;
+    }
+
+}//namespace SDF
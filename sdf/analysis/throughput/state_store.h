@@ -0,0 +1,143 @@
+/*
+ *  TU Eindhoven
+ *  Eindhoven, The Netherlands
+ *
+ *  Name            :   state_store.h
+ *
+ *  Author          :   agent (agent@local)
+ *
+ *  Date            :   October 19, 2026
+ *
+ *  Function        :   Bounded-memory store for visited states
+ *
+ *  History         :
+ *      19-10-26    :   Initial version.
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, 59 Temple Place - Suite 330, Boston, MA 02111-1307, USA.
+ *
+ * In other words, you are welcome to use, share and improve this program.
+ * You are forbidden to forbid anyone else to use, share and improve
+ * what you give them.   Happy coding!
+ */
+
+
+#ifndef SDF_ANALYSIS_STATESPACE_STATE_STORE_H_INCLUDED
+#define SDF_ANALYSIS_STATESPACE_STATE_STORE_H_INCLUDED
+
+#include "../../base/timed/graph.h"
+#include <cstdio>
+
+namespace SDF
+{
+    /**
+     * SDFstateSpaceStateStore
+     * Store for the states visited by a state-space transition system. A state
+     * is handed to the store as a sequence of words. Every state is kept as a
+     * variable-length encoded record. The records are found through an
+     * open-addressing hash index which is kept in memory. When the records in
+     * memory exceed the memory limit, they are moved to a temporary file which
+     * is mapped into memory when a record must be compared. The index and the
+     * hash value, start of the record and global clock value of every state
+     * (about 40 bytes per state) always stay in memory. They are counted
+     * toward the memory limit, but the limit is exceeded when they outgrow it.
+     * States are numbered in the order in which they are stored.
+     */
+    class SDFstateSpaceStateStore
+    {
+        public:
+            // Position of a state in the store
+            typedef unsigned long long Index;
+
+            // Constructor
+            SDFstateSpaceStateStore();
+
+            // Destructor
+            ~SDFstateSpaceStateStore();
+
+            // Remove all states
+            void clear();
+
+            // Store the state unless it is already stored
+            bool store(const vector<unsigned long long> &state,
+                       const unsigned long long clk, Index &pos);
+
+            // Number of stored states
+            Index size() const
+            {
+                return clks.size();
+            };
+
+            // Global clock value of a stored state
+            unsigned long long getClk(const Index pos) const
+            {
+                return clks[pos];
+            };
+
+            // Maximal number of bytes used by the store (0 = no limit)
+            void setMemoryLimit(const unsigned long long limit)
+            {
+                memoryLimit = limit;
+            };
+            static void setDefaultMemoryLimit(const unsigned long long limit)
+            {
+                defaultMemoryLimit = limit;
+            };
+
+        private:
+            // The spill file is owned by the store, stores cannot be copied
+            SDFstateSpaceStateStore(const SDFstateSpaceStateStore &);
+            SDFstateSpaceStateStore &operator=(const SDFstateSpaceStateStore &);
+
+            // Encoding of a state
+            void encode(const vector<unsigned long long> &state);
+            static unsigned int hash(const vector<unsigned char> &record);
+
+            // Access to the records
+            bool recordEquals(const Index pos, const vector<unsigned char> &r);
+            const unsigned char *mapSpilledRecords();
+            void spillRecords();
+            void closeSpillFile();
+
+            // Hash index
+            void growIndex();
+            unsigned long long recordMemoryLimit() const;
+
+            // Index with (position + 1) of the states (0 = empty slot)
+            vector<Index> index;
+
+            // Hash value, start of the record and global clock of every state
+            vector<unsigned int> hashes;
+            vector<unsigned long long> offsets;
+            vector<unsigned long long> clks;
+
+            // Records in memory (the records before spillOffset are stored
+            // in the spill file)
+            vector<unsigned char> records;
+            unsigned long long spillOffset;
+
+            // Spill file and its mapping into memory
+            CString spillFileName;
+            FILE *spillFile;
+            unsigned char *spillMap;
+            unsigned long long spillMapSize;
+
+            // Encoded state which is being stored
+            vector<unsigned char> record;
+
+            // Memory limit
+            unsigned long long memoryLimit;
+            static unsigned long long defaultMemoryLimit;
+    };
+}//namespace SDF
+#endif
@@ -0,0 +1,451 @@
+/*
+ *  TU Eindhoven
+ *  Eindhoven, The Netherlands
+ *
+ *  Name            :   symmetry.cc
+ *
+ *  Author          :   agent (agent@local)
+ *
+ *  Date            :   October 19, 2026
+ *
+ *  Function        :   Symmetry reduction for state-space analysis
+ *
+ *  History         :
+ *      19-10-26    :   Initial version.
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, 59 Temple Place - Suite 330, Boston, MA 02111-1307, USA.
+ *
+ * In other words, you are welcome to use, share and improve this program.
+ * You are forbidden to forbid anyone else to use, share and improve
+ * what you give them.   Happy coding!
+ */
+
+#include "symmetry.h"
+#include <algorithm>
+
+namespace SDF
+{
+    /**
+     * refineColors ()
+     * The function colors the actors of the graph such that actors with a
+     * different color can never be mapped on each other by an automorphism.
+     * Initially, actors are colored on their execution time and number of
+     * ports. Next, the color of an actor is refined with the colors of its
+     * neighbors and the properties of the channels connecting them till the
+     * number of colors is stable.
+     */
+    void SDFstateSpaceSymmetry::refineColors(TimedSDFgraph *g,
+            vector<uint> &color) const
+    {
+        map<vector<unsigned long long>, uint> index;
+        vector<unsigned long long> key;
+        vector< vector<unsigned long long> > neighbors(g->nrActors());
+        vector< vector<SDFactor *> > neighborActors(g->nrActors());
+        vector<uint> newColor(g->nrActors());
+        uint nrColors, id;
+
+        // Label every port with the direction, rates and initial tokens of
+        // its channel
+        for (SDFactorsIter iter = g->actorsBegin(); iter != g->actorsEnd(); iter++)
+        {
+            SDFactor *a = *iter;
+
+            for (SDFportsIter pIter = a->portsBegin(); pIter != a->portsEnd();
+                 pIter++)
+            {
+                SDFport *p = *pIter;
+                SDFchannel *c = p->getChannel();
+                SDFactor *b = p->getType() == SDFport::In
+                              ? c->getSrcActor() : c->getDstActor();
+
+                key.clear();
+                key.push_back(p->getType());
+                key.push_back(c->getSrcPort()->getRate());
+                key.push_back(c->getDstPort()->getRate());
+                key.push_back(c->getInitialTokens());
+                key.push_back(b == a);
+
+                id = index.size();
+                id = index.insert(std::make_pair(key, id)).first->second;
+
+                neighbors[a->getId()].push_back((unsigned long long)id << 32);
+                neighborActors[a->getId()].push_back(b == a ? NULL : b);
+            }
+        }
+        index.clear();
+
+        // Initial colors
+        color.resize(g->nrActors());
+        for (SDFactorsIter iter = g->actorsBegin(); iter != g->actorsEnd(); iter++)
+        {
+            TimedSDFactor *a = (TimedSDFactor *)(*iter);
+            vector<unsigned long long> &n = neighbors[a->getId()];
+
+            key.clear();
+            key.push_back(a->getExecutionTime());
+            key.insert(key.end(), n.begin(), n.end());
+            std::sort(key.begin() + 1, key.end());
+
+            id = index.size();
+            color[a->getId()] =
+                index.insert(std::make_pair(key, id)).first->second;
+        }
+        nrColors = index.size();
+
+        // Refine colors with the neighborhood of the actors
+        for (uint i = 0; i < g->nrActors(); i++)
+        {
+            index.clear();
+
+            for (SDFactorsIter iter = g->actorsBegin(); iter != g->actorsEnd();
+                 iter++)
+            {
+                SDFactor *a = *iter;
+                vector<unsigned long long> &n = neighbors[a->getId()];
+                vector<SDFactor *> &b = neighborActors[a->getId()];
+
+                key.clear();
+                key.push_back(color[a->getId()]);
+                for (uint j = 0; j < n.size(); j++)
+                {
+                    key.push_back((n[j] & 0xffffffff00000000ULL)
+                                  | (b[j] == NULL ? 0 : color[b[j]->getId()]));
+                }
+                std::sort(key.begin() + 1, key.end());
+
+                id = index.size();
+                newColor[a->getId()] =
+                    index.insert(std::make_pair(key, id)).first->second;
+            }
+
+            // Coloring stable?
+            if (index.size() == nrColors)
+                break;
+
+            color.swap(newColor);
+            nrColors = index.size();
+        }
+    }
+
+    /**
+     * orderBlockChannels ()
+     * The function collects the channels of every block in the group. The
+     * channels of a block are ordered on the position in the block of their
+     * source and destination actor (or on the actor when it is outside the
+     * group), rates and initial tokens. The function returns true when the
+     * ordered channels of all blocks match each other. In that case, every
+     * permutation of the blocks is an automorphism of the graph. The function
+     * returns false when the blocks do not match or when a channel connects
+     * two different blocks.
+     */
+    bool SDFstateSpaceSymmetry::orderBlockChannels(TimedSDFgraph *g,
+            Group &group) const
+    {
+        typedef std::pair<vector<unsigned long long>, CId> ChannelKey;
+        vector<uint> blockOf(g->nrActors(), UINT_MAX);
+        vector<uint> member(g->nrActors());
+        vector<ChannelKey> keys, firstKeys;
+        uint blockSize = group[0].actors.size();
+
+        // Position of the actors in the blocks
+        for (uint i = 0; i < group.size(); i++)
+        {
+            for (uint r = 0; r < group[i].actors.size(); r++)
+            {
+                blockOf[group[i].actors[r]->getId()] = i;
+                member[group[i].actors[r]->getId()] = r;
+            }
+        }
+
+        for (uint i = 0; i < group.size(); i++)
+        {
+            Block &b = group[i];
+
+            keys.clear();
+            for (uint r = 0; r < b.actors.size(); r++)
+            {
+                SDFactor *a = b.actors[r];
+
+                for (SDFportsIter iter = a->portsBegin(); iter != a->portsEnd();
+                     iter++)
+                {
+                    SDFport *p = *iter;
+                    SDFchannel *c = p->getChannel();
+                    SDFactor *end[2] = { c->getSrcActor(), c->getDstActor() };
+                    vector<unsigned long long> key;
+
+                    // Visit a channel inside the block only from its source
+                    if (p->getType() == SDFport::In
+                        && blockOf[end[0]->getId()] == i)
+                    {
+                        continue;
+                    }
+
+                    for (uint e = 0; e < 2; e++)
+                    {
+                        CId id = end[e]->getId();
+
+                        if (blockOf[id] == i)
+                            key.push_back(member[id]);
+                        else if (blockOf[id] != UINT_MAX)
+                            return false;
+                        else if (groupOfActor[id] != UINT_MAX)
+                            return false;
+                        else
+                            key.push_back(blockSize + id);
+                    }
+                    key.push_back(c->getSrcPort()->getRate());
+                    key.push_back(c->getDstPort()->getRate());
+                    key.push_back(c->getInitialTokens());
+
+                    keys.push_back(ChannelKey(key, c->getId()));
+                }
+            }
+            std::sort(keys.begin(), keys.end());
+
+            // Channels of the block must match with the first block
+            if (i == 0)
+            {
+                firstKeys = keys;
+            }
+            else
+            {
+                if (keys.size() != firstKeys.size())
+                    return false;
+
+                for (uint j = 0; j < keys.size(); j++)
+                {
+                    if (keys[j].first != firstKeys[j].first)
+                        return false;
+                }
+            }
+
+            b.channels.clear();
+            for (uint j = 0; j < keys.size(); j++)
+                b.channels.push_back(keys[j].second);
+        }
+
+        return true;
+    }
+
+    /**
+     * createGroup ()
+     * The function tries to create a group of blocks which starts with one
+     * actor from the color class seed per block. The blocks are extended with
+     * color classes of the same size whose actors are each adjacent to exactly
+     * one block (and every block to exactly one actor of the class). The
+     * function returns true when every permutation of the resulting blocks is
+     * an automorphism of the graph.
+     */
+    bool SDFstateSpaceSymmetry::createGroup(TimedSDFgraph *g,
+            const vector< vector<SDFactor *> > &classes, const uint seed,
+            vector<bool> &usedClass, Group &group) const
+    {
+        uint k = classes[seed].size();
+        vector<uint> blockOf(g->nrActors(), UINT_MAX);
+        vector<bool> member(classes.size(), false);
+        vector<uint> target(k);
+        vector<bool> hit(k);
+        bool changed = true;
+
+        // One actor of the seed class per block
+        group.clear();
+        group.resize(k);
+        for (uint i = 0; i < k; i++)
+        {
+            group[i].actors.push_back(classes[seed][i]);
+            blockOf[classes[seed][i]->getId()] = i;
+        }
+        member[seed] = true;
+
+        // Extend the blocks with classes which are adjacent to the blocks
+        while (changed)
+        {
+            changed = false;
+
+            for (uint d = 0; d < classes.size(); d++)
+            {
+                bool ok = true;
+
+                if (usedClass[d] || member[d] || classes[d].size() != k)
+                    continue;
+
+                hit.assign(k, false);
+                for (uint j = 0; j < k && ok; j++)
+                {
+                    SDFactor *a = classes[d][j];
+                    uint b = UINT_MAX;
+
+                    for (SDFportsIter iter = a->portsBegin();
+                         iter != a->portsEnd() && ok; iter++)
+                    {
+                        SDFport *p = *iter;
+                        SDFactor *n = p->getType() == SDFport::In
+                                      ? p->getChannel()->getSrcActor()
+                                      : p->getChannel()->getDstActor();
+                        uint bn = blockOf[n->getId()];
+
+                        if (bn == UINT_MAX)
+                            continue;
+                        if (b == UINT_MAX)
+                            b = bn;
+                        else if (b != bn)
+                            ok = false;
+                    }
+
+                    if (b == UINT_MAX || hit[b])
+                    {
+                        ok = false;
+                    }
+                    else
+                    {
+                        hit[b] = true;
+                        target[j] = b;
+                    }
+                }
+
+                if (!ok)
+                    continue;
+
+                for (uint j = 0; j < k; j++)
+                {
+                    group[target[j]].actors.push_back(classes[d][j]);
+                    blockOf[classes[d][j]->getId()] = target[j];
+                }
+                member[d] = true;
+                changed = true;
+            }
+        }
+
+        // All permutations of the blocks are automorphisms?
+        if (!orderBlockChannels(g, group))
+            return false;
+
+        for (uint d = 0; d < classes.size(); d++)
+        {
+            if (member[d])
+                usedClass[d] = true;
+        }
+
+        return true;
+    }
+
+    /**
+     * init ()
+     * The function detects the groups of interchangeable blocks in the graph g.
+     */
+    void SDFstateSpaceSymmetry::init(TimedSDFgraph *g)
+    {
+        vector< vector<SDFactor *> > classes;
+        vector<bool> usedClass;
+        vector<uint> color;
+
+        groups.clear();
+        groupOfActor.assign(g->nrActors(), UINT_MAX);
+        mirroredActor.assign(g->nrActors(), false);
+        mirroredChannel.assign(g->nrChannels(), false);
+
+        // Actors which may be mapped on each other
+        refineColors(g, color);
+        for (SDFactorsIter iter = g->actorsBegin(); iter != g->actorsEnd(); iter++)
+        {
+            CId id = (*iter)->getId();
+
+            if (color[id] >= classes.size())
+                classes.resize(color[id] + 1);
+            classes[color[id]].push_back(*iter);
+        }
+        usedClass.resize(classes.size(), false);
+
+        // Create groups starting from every class with more than one actor
+        for (uint c = 0; c < classes.size(); c++)
+        {
+            Group group;
+
+            if (usedClass[c] || classes[c].size() < 2)
+                continue;
+
+            if (!createGroup(g, classes, c, usedClass, group))
+                continue;
+
+            for (uint i = 0; i < group.size(); i++)
+            {
+                for (uint r = 0; r < group[i].actors.size(); r++)
+                    groupOfActor[group[i].actors[r]->getId()] = groups.size();
+            }
+            groups.push_back(group);
+        }
+
+        initMirrors();
+    }
+
+    /**
+     * initMirrors ()
+     * The function marks the actors and channels of all blocks, except the
+     * first block of every group, as mirrored. It also records the group of
+     * every actor.
+     */
+    void SDFstateSpaceSymmetry::initMirrors()
+    {
+        groupOfActor.assign(groupOfActor.size(), UINT_MAX);
+        mirroredActor.assign(mirroredActor.size(), false);
+        mirroredChannel.assign(mirroredChannel.size(), false);
+
+        for (uint j = 0; j < groups.size(); j++)
+        {
+            for (uint i = 0; i < groups[j].size(); i++)
+            {
+                const Block &b = groups[j][i];
+
+                for (uint r = 0; r < b.actors.size(); r++)
+                {
+                    groupOfActor[b.actors[r]->getId()] = j;
+                    mirroredActor[b.actors[r]->getId()] = (i != 0);
+                }
+
+                for (uint c = 0; c < b.channels.size(); c++)
+                    mirroredChannel[b.channels[c]] = (i != 0);
+            }
+        }
+    }
+
+    /**
+     * fixActor ()
+     * The function removes the group which moves actor a (if any). Afterwards,
+     * the actor is fixed by all permutations.
+     */
+    void SDFstateSpaceSymmetry::fixActor(SDFactor *a)
+    {
+        if (isFixed(a))
+            return;
+
+        groups.erase(groups.begin() + groupOfActor[a->getId()]);
+        initMirrors();
+    }
+
+    /**
+     * nrMirroredActors ()
+     * The function returns the number of actors which are mirrored by another
+     * actor.
+     */
+    uint SDFstateSpaceSymmetry::nrMirroredActors() const
+    {
+        uint n = 0;
+
+        for (uint j = 0; j < groups.size(); j++)
+            n += (groups[j].size() - 1) * groups[j][0].actors.size();
+
+        return n;
+    }
+}//namespace SDF
@@ -0,0 +1,131 @@
+/*
+ *  TU Eindhoven
+ *  Eindhoven, The Netherlands
+ *
+ *  Name            :   symmetry.h
+ *
+ *  Author          :   agent (agent@local)
+ *
+ *  Date            :   October 19, 2026
+ *
+ *  Function        :   Symmetry reduction for state-space analysis
+ *
+ *  History         :
+ *      19-10-26    :   Initial version.
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, 59 Temple Place - Suite 330, Boston, MA 02111-1307, USA.
+ *
+ * In other words, you are welcome to use, share and improve this program.
+ * You are forbidden to forbid anyone else to use, share and improve
+ * what you give them.   Happy coding!
+ */
+
+#ifndef SDF_ANALYSIS_STATESPACE_SYMMETRY_H_INCLUDED
+#define SDF_ANALYSIS_STATESPACE_SYMMETRY_H_INCLUDED
+
+#include "../../base/timed/graph.h"
+
+namespace SDF
+{
+    /**
+     * SDFstateSpaceSymmetry
+     * Symmetry reduction shared by the state-space transition systems. Graphs
+     * obtained through an HSDF conversion often contain groups of identical
+     * actors (or identical chains of actors) which are connected to the same
+     * other actors. Every permutation of the members (blocks) of such a group
+     * is an automorphism of the graph. The groups are detected once per graph.
+     * Only groups for which every block permutation is verified to be an
+     * automorphism are used.
+     *
+     * The initial state of a self-timed execution is invariant under every
+     * automorphism. Since the execution is deterministic, all states visited
+     * are invariant too. In other words, all blocks of a group always have the
+     * same contents, so it suffices to execute the first block. The actors and
+     * channels of the other blocks are mirrored by the first block and can be
+     * skipped by the transition system.
+     */
+    class SDFstateSpaceSymmetry
+    {
+        public:
+            // Constructor
+            SDFstateSpaceSymmetry() {};
+
+            // Destructor
+            ~SDFstateSpaceSymmetry() {};
+
+            // Detect the groups of interchangeable blocks in the graph
+            void init(TimedSDFgraph *g);
+
+            // Remove the group which moves actor a
+            void fixActor(SDFactor *a);
+
+            // Actor moved by a permutation?
+            bool isFixed(const SDFactor *a) const
+            {
+                return groupOfActor.empty()
+                       || groupOfActor[a->getId()] == UINT_MAX;
+            };
+
+            // Actor or channel mirrored by the first block of its group?
+            bool isMirrored(const SDFactor *a) const
+            {
+                return !mirroredActor.empty() && mirroredActor[a->getId()];
+            };
+            bool isMirrored(const SDFchannel *c) const
+            {
+                return !mirroredChannel.empty() && mirroredChannel[c->getId()];
+            };
+
+            // Number of groups and number of mirrored actors
+            uint nrGroups() const
+            {
+                return groups.size();
+            };
+            uint nrMirroredActors() const;
+
+        private:
+            // Actors and channels of a block (position i of all blocks in a
+            // group is mapped on each other by the permutations)
+            typedef struct _Block
+            {
+                vector<SDFactor *> actors;
+                vector<CId> channels;
+            } Block;
+
+            // Group of interchangeable blocks
+            typedef vector<Block> Group;
+
+            // Detection of the groups
+            void refineColors(TimedSDFgraph *g, vector<uint> &color) const;
+            bool createGroup(TimedSDFgraph *g,
+                             const vector< vector<SDFactor *> > &classes,
+                             const uint seed, vector<bool> &usedClass,
+                             Group &group) const;
+            bool orderBlockChannels(TimedSDFgraph *g, Group &group) const;
+
+            // Update the actors and channels which are mirrored
+            void initMirrors();
+
+            // Groups of interchangeable blocks
+            vector<Group> groups;
+
+            // Group which moves the actor (UINT_MAX when actor is fixed)
+            vector<uint> groupOfActor;
+
+            // Actors and channels of all blocks except the first of a group
+            vector<bool> mirroredActor;
+            vector<bool> mirroredChannel;
+    };
+}//namespace SDF
+#endif
@@ -74,6 +74,37 @@ namespace SDF
         }
     }
 
+    /**
+     * pack ()
+     * The function stores the words which identify the state in words. Two
+     * states are equal when their words are equal.
+     */
+    void SDFstateSpaceBindingAwareThroughputAnalysis::TransitionSystem::State
+    ::pack(vector<unsigned long long> &words) const
+    {
+        words.clear();
+        words.push_back(glbClk);
+
+        for (uint i = 0; i < ch.size(); i++)
+            words.push_back(ch[i]);
+
+        for (uint i = 0; i < actClk.size(); i++)
+        {
+            words.push_back(actClk[i].size());
+            for (list<SDFtime>::const_iterator iter = actClk[i].begin();
+                 iter != actClk[i].end(); iter++)
+            {
+                words.push_back(*iter);
+            }
+        }
+
+        for (uint i = 0; i < schedulePos.size(); i++)
+        {
+            words.push_back(schedulePos[i]);
+            words.push_back(tdmaPos[i]);
+        }
+    }
+
     /**
      * operator= ()
      * The function compares to states and returns true if they are equal.
@@ -162,9 +193,13 @@ namespace SDF
         repVec = computeRepetitionVector(bindingAwareSDFG);
 
         // Select actor with lowest entry in repetition vector as output actor
+        // (actors mirrored by another actor are not executed)
         for (SDFactorsIter iter = bindingAwareSDFG->actorsBegin();
              iter != bindingAwareSDFG->actorsEnd(); iter++)
         {
+            if (symmetry.isMirrored(*iter))
+                continue;
+
             if (repVec[(*iter)->getId()] < min)
             {
                 a = *iter;
@@ -204,37 +239,41 @@ namespace SDF
     }
 
     /**
-     * storeState ()
-     * The function stores the state s on whenever s is not already in the
-     * list of storedStates. When s is stored, the function returns true. When the
-     * state s is already in the list, the state s is not stored. The function
-     * returns false. The function always sets the pos variable to the position
-     * where the state s is in the list.
+     * initSymmetry ()
+     * The function detects the symmetries between the actors of the
+     * binding-aware SDFG. Actors bound to a tile appear in the static-order
+     * schedule of the tile and are therefore never moved.
      */
-    bool SDFstateSpaceBindingAwareThroughputAnalysis::TransitionSystem::storeState(
-        State &s, StatesIter &pos)
+    void SDFstateSpaceBindingAwareThroughputAnalysis::TransitionSystem
+    ::initSymmetry()
     {
-        // Find state in the list of stored states
-        for (StatesIter iter = storedStates.begin();
-             iter != storedStates.end(); iter++)
-        {
-            State &x = *iter;
+        symmetry.init(bindingAwareSDFG);
 
-            // State s at position iter in the list?
-            if (x == s)
+        for (SDFactorsIter iter = bindingAwareSDFG->actorsBegin();
+             iter != bindingAwareSDFG->actorsEnd(); iter++)
+        {
+            if (bindingAwareSDFG->getBindingOfActorToTile(*iter)
+                != ACTOR_NOT_BOUND)
             {
-                pos = iter;
-                return false;
+                symmetry.fixActor(*iter);
             }
         }
+    }
 
-        // State not found, store it at the end of the list
-        storedStates.push_back(s);
-
-        // Added state to the end of the list
-        pos = storedStates.end();
+    /**
+     * storeState ()
+     * The function stores the state s whenever s is not already in the set of
+     * storedStates. When s is stored, the function returns true. When the
+     * state s is already stored, the function returns false. The function
+     * always sets the pos variable to the position of the state s in the
+     * stored states.
+     */
+    bool SDFstateSpaceBindingAwareThroughputAnalysis::TransitionSystem::storeState(
+        State &s, SDFstateSpaceStateStore::Index &pos)
+    {
+        s.pack(packedState);
 
-        return true;
+        return storedStates.store(packedState, s.glbClk, pos);
     }
 
     /**
@@ -243,22 +282,21 @@ namespace SDF
      * value is equal to the average number of firings of an actor per time unit.
      */
     TDtime SDFstateSpaceBindingAwareThroughputAnalysis::TransitionSystem
-    ::computeThroughput(const StatesIter cycleIter)
+    ::computeThroughput(const SDFstateSpaceStateStore::Index cycleStart)
     {
         int nr_fire = 0;
         TDtime time = 0;
 
         // Check all state from stack till cycle complete
-        for (StatesIter iter = cycleIter; iter != storedStates.end(); iter++)
+        for (SDFstateSpaceStateStore::Index i = cycleStart;
+             i < storedStates.size(); i++)
         {
-            State &s = *iter;
-
             // Number of states in cycle is equal to number of iterations
             // in the period
             nr_fire++;
 
             // Time between previous state
-            time += s.glbClk;
+            time += storedStates.getClk(i);
         }
 
         return (TDtime)(nr_fire) / (time);
@@ -270,7 +308,7 @@ namespace SDF
      * during the periodic part of the execution.
      */
     void SDFstateSpaceBindingAwareThroughputAnalysis::TransitionSystem
-    ::computeTileUtilization(const StatesIter recurrentState,
+    ::computeTileUtilization(const SDFstateSpaceStateStore::Index recurrentState,
                              vector<double> &tileUtilization)
     {
         RepetitionVector repVec = computeRepetitionVector(bindingAwareSDFG);
@@ -283,17 +321,15 @@ namespace SDF
             tileUtilization[t] = 0;
 
         // Check all state from stack till cycle complete
-        for (StatesIter iter = recurrentState;
-             iter != storedStates.end(); iter++)
+        for (SDFstateSpaceStateStore::Index i = recurrentState;
+             i < storedStates.size(); i++)
         {
-            State &s = *iter;
-
             // Number of states in cycle is equal to number of iterations
             // in the period
             nrItersInPeriod++;
 
             // Time between previous state
-            lengthOfPeriod += s.glbClk;
+            lengthOfPeriod += storedStates.getClk(i);
         }
 
         // The activity of a processor is given by the sum of execution time of the
@@ -323,7 +359,8 @@ namespace SDF
      *****************************************************************************/
 
 #define CH(c)               currentState.ch[c]
-#define TDMA_POS(p)         currentState.tdmaPos[p]
+#define TDMA_POS(p)         ((SDFtime)(events.getTime() \
+                                % bindingAwareSDFG->getTDMAsizeOnTile(p)))
 #define SOS_POS(p)          currentState.schedulePos[p]
 
 #define SOS(p)              (bindingAwareSDFG->getScheduleOnTile(p))
@@ -334,8 +371,6 @@ namespace SDF
 #define CONSUME(c,n)        CH(c) = CH(c) - n;
 #define PRODUCE(c,n)        CH(c) = CH(c) + n;
 
-#define CH_TOKENS_PREV(c,n) (previousState.ch[c] >= n)
-
     /**
      * actorReadyToFire ()
      * The function returns true when the actor is ready to fire in state
@@ -344,6 +379,10 @@ namespace SDF
     bool SDFstateSpaceBindingAwareThroughputAnalysis::TransitionSystem
     ::actorReadyToFire(SDFactor *a)
     {
+        // Actor mirrored by another actor?
+        if (symmetry.isMirrored(a))
+            return false;
+
         // Actor bound to processor?
         if (bindingAwareSDFG->getBindingOfActorToTile(a) != ACTOR_NOT_BOUND)
         {
@@ -360,6 +399,10 @@ namespace SDF
             SDFport *p = *iter;
             SDFchannel *c = p->getChannel();
 
+            // Channel mirrored by another channel?
+            if (symmetry.isMirrored(c))
+                continue;
+
             // Actor is destination of the channel?
             if (p->getType() == SDFport::In)
             {
@@ -391,6 +434,10 @@ namespace SDF
             SDFport *p = *iter;
             SDFchannel *c = p->getChannel();
 
+            // Channel mirrored by another channel?
+            if (symmetry.isMirrored(c))
+                continue;
+
             // Actor is destination of the channel?
             if (p->getType() == SDFport::In)
             {
@@ -411,7 +458,7 @@ namespace SDF
             uint p = bindingAwareSDFG->getBindingOfActorToTile(a);
 
             // Time wheel has not yet reached start of slice?
-            if (currentState.tdmaPos[p]
+            if (TDMA_POS(p)
                 < bindingAwareSDFG->getTDMAsizeOnTile(p)
                 - bindingAwareSDFG->getTDMAsliceOnTile(p))
             {
@@ -420,7 +467,7 @@ namespace SDF
                 // of the slice
                 timeTileStartOfSlice = bindingAwareSDFG->getTDMAsizeOnTile(p)
                                        - bindingAwareSDFG->getTDMAsliceOnTile(p)
-                                       - currentState.tdmaPos[p];
+                                       - TDMA_POS(p);
                 nrOfFullRotationsInNonReservedPart = (int) ceil((double) execTime
                                                      / bindingAwareSDFG->getTDMAsliceOnTile(p)) - 1;
                 waitingTime = (bindingAwareSDFG->getTDMAsizeOnTile(p)
@@ -435,7 +482,7 @@ namespace SDF
                 // firing
                 remainingExecTime = (int)execTime
                                     - (int)bindingAwareSDFG->getTDMAsizeOnTile(p)
-                                    + (int)currentState.tdmaPos[p];
+                                    + (int)TDMA_POS(p);
 
                 if (remainingExecTime < 0)
                 {
@@ -454,31 +501,13 @@ namespace SDF
         }
 
         // Add actor firing to the list of active firings of this actor
-        currentState.actClk[a->getId()].push_back(completionTime);
+        events.startFiring(a, completionTime);
 
 #ifdef _PRINT_STATESPACE
         cout << "start: " << a->getName() << endl;
 #endif
     }
 
-    /**
-     * actorReadyToEnd ()
-     * The function returns true when the actor is ready to end its firing. Else
-     * the function returns false.
-     */
-    bool SDFstateSpaceBindingAwareThroughputAnalysis::TransitionSystem
-    ::actorReadyToEnd(SDFactor *a)
-    {
-        if (currentState.actClk[a->getId()].empty())
-            return false;
-
-        // First actor firing in sorted list has execution time left?
-        if (currentState.actClk[a->getId()].front() != 0)
-            return false;
-
-        return true;
-    }
-
     /**
      * endActorFiring ()
      * Produce tokens on all output channels and remove the actor firing from the
@@ -492,15 +521,22 @@ namespace SDF
             SDFport *p = *iter;
             SDFchannel *c = p->getChannel();
 
+            // Channel mirrored by another channel?
+            if (symmetry.isMirrored(c))
+                continue;
+
             // Actor is source of the channel?
             if (p->getType() == SDFport::Out)
             {
                 PRODUCE(c->getId(), p->getRate());
+
+                // Destination actor may have become enabled
+                events.markCandidate(c->getDstActor());
             }
         }
 
         // Remove the firing from the list of active actor firings
-        currentState.actClk[a->getId()].pop_front();
+        events.endFiring(a);
 
         // Actor bound to processor?
         if (bindingAwareSDFG->getBindingOfActorToTile(a) != ACTOR_NOT_BOUND)
@@ -509,6 +545,9 @@ namespace SDF
 
             // Advance the schedule to the next state
             SOS_POS(p) = SOS_NEXT_POS(p);
+
+            // Next actor in the schedule may have become enabled
+            events.markCandidate(SOS_ENTRY(p)->actor);
         }
 
 #ifdef _PRINT_STATESPACE
@@ -517,64 +556,17 @@ namespace SDF
     }
 
     /**
-     * clockStep ()
-     * The function progresses time till the first end of firing transition
-     * becomes enabled. The time step is returned. In case of deadlock, the
-     * time step is equal to UINT_MAX.
+     * updateState ()
+     * The function stores the remaining execution time of all active firings
+     * and the position of the time wheels in the current state.
      */
-    SDFtime SDFstateSpaceBindingAwareThroughputAnalysis::TransitionSystem
-    ::clockStep()
+    void SDFstateSpaceBindingAwareThroughputAnalysis::TransitionSystem
+    ::updateState()
     {
-        SDFtime step = UINT_MAX;
-
-        // Find maximal time progress
-        for (uint a = 0; a < bindingAwareSDFG->nrActors(); a++)
-        {
-            if (!currentState.actClk[a].empty())
-            {
-                SDFtime actClk = currentState.actClk[a].front();
-
-                if (step > actClk)
-                    step = actClk;
-            }
-        }
-
-        // Still actors ready to end their firing?
-        if (step == 0)
-            return 0;
+        events.getRemainingTimes(currentState.actClk);
 
-        // Check for progress (i.e. no deadlock)
-        if (step == UINT_MAX)
-            return UINT_MAX;
-
-        // Lower remaining execution time actors
-        for (uint a = 0; a < bindingAwareSDFG->nrActors(); a++)
-        {
-            for (list<SDFtime>::iterator iter = currentState.actClk[a].begin();
-                 iter != currentState.actClk[a].end(); iter++)
-            {
-                SDFtime &actFiringTime = *iter;
-
-                // Lower remaining execution time of the actor firing
-                actFiringTime -= step;
-            }
-        }
-
-        // Advance the time wheels
         for (uint t = 0; t < bindingAwareSDFG->nrTilesInPlatformGraph(); t++)
-        {
-            currentState.tdmaPos[t] = (currentState.tdmaPos[t] + step)
-                                      % bindingAwareSDFG->getTDMAsizeOnTile(t);
-        }
-
-        // Advance the global clock
-        currentState.glbClk += step;
-
-#ifdef _PRINT_STATESPACE
-        cout << "clk:   " << step << endl;
-#endif
-
-        return step;
+            currentState.tdmaPos[t] = TDMA_POS(t);
     }
 
     /**
@@ -585,7 +577,7 @@ namespace SDF
     TDtime SDFstateSpaceBindingAwareThroughputAnalysis::TransitionSystem
     ::execSDFgraph(vector<double> &tileUtilization)
     {
-        StatesIter recurrentState;
+        SDFstateSpaceStateStore::Index recurrentState;
         SDFtime clkStep;
         int repCnt = 0;
 
@@ -597,10 +589,7 @@ namespace SDF
                           bindingAwareSDFG->nrChannels(),
                           bindingAwareSDFG->nrTilesInPlatformGraph());
         currentState.clear();
-        previousState.init(bindingAwareSDFG->nrActors(),
-                           bindingAwareSDFG->nrChannels(),
-                           bindingAwareSDFG->nrTilesInPlatformGraph());
-        previousState.clear();
+        events.clear();
 
         // Initial tokens
         for (SDFchannelsIter iter = bindingAwareSDFG->channelsBegin();
@@ -615,7 +604,6 @@ namespace SDF
         for (uint p = 0; p < bindingAwareSDFG->nrTilesInPlatformGraph(); p++)
         {
             SOS_POS(p) = 0;
-            TDMA_POS(p) = 0;
         }
 
 #ifdef _PRINT_STATESPACE
@@ -625,25 +613,22 @@ namespace SDF
         // Fire the actors
         while (true)
         {
-            // Store partial state to check for progress
-            for (uint i = 0; i < bindingAwareSDFG->nrChannels(); i++)
-            {
-                previousState.ch[i] = currentState.ch[i];
-            }
-
             // Finish actor firings
-            for (SDFactorsIter iter = bindingAwareSDFG->actorsBegin();
-                 iter != bindingAwareSDFG->actorsEnd(); iter++)
+            const vector<SDFactor *> &ending = events.actorsEndingNow();
+            for (vector<SDFactor *>::const_iterator iter = ending.begin();
+                 iter != ending.end(); iter++)
             {
                 SDFactor *a = *iter;
 
-                while (actorReadyToEnd(a))
+                while (events.firingEnds(a))
                 {
                     if (outputActor->getId() == a->getId())
                     {
                         repCnt++;
                         if (repCnt == outputActorRepCnt)
                         {
+                            // Active firings and time wheels
+                            updateState();
 #ifdef _PRINT_STATESPACE
                             currentState.print(cout);
 #endif
@@ -671,8 +656,9 @@ namespace SDF
             }
 
             // Start actor firings
-            for (SDFactorsIter iter = bindingAwareSDFG->actorsBegin();
-                 iter != bindingAwareSDFG->actorsEnd(); iter++)
+            const vector<SDFactor *> &candidates = events.readyCandidates();
+            for (vector<SDFactor *>::const_iterator iter = candidates.begin();
+                 iter != candidates.end(); iter++)
             {
                 TimedSDFactor *a = (TimedSDFactor *)(*iter);
 
@@ -685,7 +671,7 @@ namespace SDF
             }
 
             // Clock step
-            clkStep = clockStep();
+            clkStep = events.clockStep();
 
             // Deadlocked?
             if (clkStep == UINT_MAX)
@@ -696,6 +682,14 @@ namespace SDF
 #endif
                 return 0;
             }
+
+            // Advance the global clock
+            currentState.glbClk += clkStep;
+
+#ifdef _PRINT_STATESPACE
+            if (clkStep != 0)
+                cout << "clk:   " << clkStep << endl;
+#endif
         }
 
         return 0;
@@ -720,7 +714,7 @@ namespace SDF
             throw CException("Graph is not strongly connected.");
 
         // Create a transition system
-        TransitionSystem transitionSystem(bg);
+        TransitionSystem transitionSystem(bg, symmetryReduction);
 
         // Find the maximal throughput
         thr = transitionSystem.execSDFgraph(tileUtilization);
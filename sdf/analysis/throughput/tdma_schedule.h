@@ -40,6 +40,9 @@
 #define SDF_ANALYSIS_STATESPACE_TDMA_SCHEDULE_H_INCLUDED
 
 #include "../../resource_allocation/binding_aware_sdfg/binding_aware_sdfg.h"
+#include "event_queue.h"
+#include "symmetry.h"
+#include "state_store.h"
 
 namespace SDF
 {
@@ -56,7 +59,10 @@ namespace SDF
     {
         public:
             // Constructor
-            SDFstateSpaceBindingAwareThroughputAnalysis() {};
+            SDFstateSpaceBindingAwareThroughputAnalysis()
+            {
+                symmetryReduction = false;
+            };
 
             // Destructor
             ~SDFstateSpaceBindingAwareThroughputAnalysis() {};
@@ -64,6 +70,13 @@ namespace SDF
             // Analyze throughput of the graph
             TDtime analyze(BindingAwareSDFG *bg, vector<double> &tileUtilization);
 
+            // Execute only one block of every group of identical actors which
+            // are not bound to a tile
+            void setSymmetryReduction(const bool flag)
+            {
+                symmetryReduction = flag;
+            };
+
         private:
 
             /***************************************************************************
@@ -108,6 +121,9 @@ namespace SDF
                             // Output state
                             void print(ostream &out);
 
+                            // Words which identify the state
+                            void pack(vector<unsigned long long> &words) const;
+
                             // State information
                             vector< list<SDFtime> > actClk;
                             vector< TBufSize > ch;
@@ -116,15 +132,15 @@ namespace SDF
                             vector< SDFtime > tdmaPos;
                     };
 
-                    // Sequence of states in transition system
-                    typedef list<State>      States;
-                    typedef States::iterator StatesIter;
-
                     // Constructor
-                    TransitionSystem(BindingAwareSDFG *bg)
+                    TransitionSystem(BindingAwareSDFG *bg,
+                                     const bool symmetryReduction = false)
                     {
                         bindingAwareSDFG = bg;
+                        events.init(bg);
                         checkBindingAwareSDFG();
+                        if (symmetryReduction)
+                            initSymmetry();
                         initOutputActor();
                     };
 
@@ -136,7 +152,7 @@ namespace SDF
 
                 private:
                     // Store state
-                    bool storeState(State &s, StatesIter &pos);
+                    bool storeState(State &s, SDFstateSpaceStateStore::Index &pos);
 
                     // Clear list of stored states
                     void clearStoredStates()
@@ -145,18 +161,21 @@ namespace SDF
                     };
 
                     // Compute throughput from transition system
-                    TDtime computeThroughput(const StatesIter cycleIter);
+                    TDtime computeThroughput(
+                        const SDFstateSpaceStateStore::Index cycleStart);
 
                     // Utilization of tiles in the platform by the application
-                    void computeTileUtilization(const StatesIter recurrentState,
-                                                vector<double> &tileUtilization);
+                    void computeTileUtilization(
+                        const SDFstateSpaceStateStore::Index recurrentState,
+                        vector<double> &tileUtilization);
 
                     // State transitions
                     bool actorReadyToFire(SDFactor *a);
                     void startActorFiring(TimedSDFactor *a);
-                    bool actorReadyToEnd(SDFactor *a);
                     void endActorFiring(SDFactor *a);
-                    SDFtime clockStep();
+
+                    // Position of the time wheels and active firings in state
+                    void updateState();
 
                     // Output actor
                     void initOutputActor();
@@ -164,6 +183,9 @@ namespace SDF
                     // Sanity checks on the binding-aware SDFG
                     void checkBindingAwareSDFG();
 
+                    // Symmetries between actors which are not bound to a tile
+                    void initSymmetry();
+
                     // Binding-aware SDFG
                     BindingAwareSDFG *bindingAwareSDFG;
 
@@ -171,13 +193,22 @@ namespace SDF
                     SDFactor *outputActor;
                     TCnt outputActorRepCnt;
 
-                    // Current and previous state
+                    // Current state
                     State currentState;
-                    State previousState;
 
-                    // List of visited states that are stored
-                    States storedStates;
+                    // Active actor firings and actors that may be enabled
+                    SDFstateSpaceEventQueue events;
+
+                    // Symmetries between actors
+                    SDFstateSpaceSymmetry symmetry;
+
+                    // Visited states that are stored
+                    SDFstateSpaceStateStore storedStates;
+                    vector<unsigned long long> packedState;
             };
+
+            // Symmetry reduction
+            bool symmetryReduction;
     };
 
 }//namespace
@@ -54,6 +54,13 @@
  */
 #include "tdma_schedule.h"
 
+/**
+ * State store
+ * Stores the states visited by a state-space analysis. The records of the
+ * states are moved to a temporary file when they exceed a memory limit.
+ */
+#include "state_store.h"
+
 /**
  * Deadlock analysis
  * Check that an SDFG is deadlock free (i.e. executing each actor as often as
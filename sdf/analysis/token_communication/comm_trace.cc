@@ -151,22 +151,13 @@ namespace SDF
     ::initOutputActor()
     {
         RepetitionVector repVec;
-        int min = INT_MAX;
-        SDFactor *a = NULL;
+        SDFactor *a;
 
         // Compute repetition vector
         repVec = computeRepetitionVector(bindingAwareSDFG);
 
         // Select actor with lowest entry in repetition vector as output actor
-        for (SDFactorsIter iter = bindingAwareSDFG->actorsBegin();
-             iter != bindingAwareSDFG->actorsEnd(); iter++)
-        {
-            if (repVec[(*iter)->getId()] < min)
-            {
-                a = *iter;
-                min = repVec[a->getId()];
-            }
-        }
+        a = selectOutputActor(bindingAwareSDFG);
 
         // Set output actor and its repetition vector count
         outputActor = a;
@@ -34,63 +34,46 @@
  */
 
 #include "components.h"
-#include "dfs.h"
 namespace SDF
 {
 
 
     /**
-     * treeVisitChildren ()
-     * The function visits all children of the actor 'u'. The parent-child
-     * relation is given via the vector 'pi'. Each child is added to the
-     * component 'comp'.
+     * stronglyConnectedComponents ()
+     * The function determines the strongly connected components in the graph
+     * on a CSR snapshot of its channels. Components are ordered on the actor
+     * with the smallest id.
      */
-    static
-    void treeVisitChildren(SDFGraph *g, SDFactor **pi, SDFactor *u,
-                           SDFgraphComponent &comp)
+    void stronglyConnectedComponents(SDFGraph *g, CSRcomponents &components)
     {
-        for (uint i = 0; i < g->nrActors(); i++)
-        {
-            // Actor v points to actor u (i.e. v is a child of u)
-            if (pi[i] != NULL && pi[i]->getId() == u->getId())
-            {
-                SDFactor *v = g->getActor(i);
-
-                // Add actor v to the component
-                comp.push_back(v);
+        CSRgraph csr(g);
 
-                // Find all children of v in the tree
-                treeVisitChildren(g, pi, v, comp);
-            }
-        }
+        stronglyConnectedComponents(csr, components);
     }
 
     /**
-     * getComponents ()
-     * The function determines the strongly connected components in the graph. To do
-     * this, it performs depth-first walk on the forest given by 'pi'.
+     * calcStronglyConnectedComponents ()
+     * The function determines the strongly connected components in the graph.
      */
     static
-    SDFgraphComponents getComponents(SDFGraph *g, SDFactor **pi)
+    SDFgraphComponents calcStronglyConnectedComponents(SDFGraph *g)
     {
         SDFgraphComponents components;
+        CSRcomponents c;
+        vector<SDFactor *> actors(g->nrActors());
 
-        for (uint i = 0; i < g->nrActors(); i++)
-        {
-            if (pi[i] == NULL)
-            {
-                SDFactor *u = g->getActor(i);
+        stronglyConnectedComponents(g, c);
 
-                // Create new component and add actor u
-                SDFgraphComponent comp;
-                comp.push_back(u);
+        for (SDFactorsIter iter = g->actorsBegin(); iter != g->actorsEnd(); iter++)
+            actors[(*iter)->getId()] = *iter;
 
-                // Find all children of u in the tree
-                treeVisitChildren(g, pi, u, comp);
+        for (uint k = 0; k < c.nrComponents(); k++)
+        {
+            components.push_back(SDFgraphComponent());
+            SDFgraphComponent &comp = components.back();
 
-                // Add component to the set of components
-                components.push_back(comp);
-            }
+            for (uint i = c.begin[k]; i < c.begin[k + 1]; i++)
+                comp.push_back(actors[c.nodes[i]]);
         }
 
         return components;
@@ -99,28 +82,20 @@ namespace SDF
     /**
      * stronglyConnectedComponents ()
      * The function determines the strongly connected components in the graph.
+     * The result is cached on the graph.
      */
     SDFgraphComponents stronglyConnectedComponents(SDFGraph *g)
     {
-        SDFgraphComponents components;
+        typedef SDFgraphCache::Value<SDFgraphComponents> CachedComponents;
+        SDFgraphCache::Artifact *cached;
 
-        // Initialize
-        v_int d(g->nrActors());
-        v_int f(g->nrActors(), 0);
-        SDFactor **pi = (SDFactor **)malloc(sizeof(SDFactor *)*g->nrActors());
-        ASSERT(pi != NULL, "Failled malloc");
+        cached = g->getCache().lookup(SDFgraphCache::ComponentsArtifact);
+        if (cached != NULL)
+            return ((CachedComponents *)cached)->value;
 
-        // Call dfs(g) ti compute f[u] for each u
-        dfs(g, d, f, pi);
-
-        // Call dfs(gT), consider the vertices in order of decreasing f[u]
-        dfs(g, d, f, pi, true);
-
-        // Components are the vertices of the trees in the depth-first forest
-        components = getComponents(g, pi);
-
-        // Cleanup
-        free(pi);
+        SDFgraphComponents components = calcStronglyConnectedComponents(g);
+        g->getCache().store(SDFgraphCache::ComponentsArtifact,
+                            new CachedComponents(components));
 
         return components;
     }
@@ -150,14 +125,11 @@ namespace SDF
      */
     bool isStronglyConnectedGraph(SDFGraph *g)
     {
-        SDFgraphComponents c;
-
-        c = stronglyConnectedComponents(g);
+        CSRcomponents c;
 
-        if (c.size() != 1)
-            return false;
+        stronglyConnectedComponents(g, c);
 
-        return true;
+        return c.nrComponents() == 1;
     }
 
     /**
@@ -38,6 +38,7 @@
 
 #include "../../../base/base.h"
 #include "../untimed/graph.h"
+#include "csr.h"
 namespace SDF
 {
 
@@ -54,9 +55,17 @@ namespace SDF
     /**
      * stronglyConnectedComponents ()
      * The function determines the strongly connected components in the graph.
+     * The result is cached on the graph.
      */
     SDFgraphComponents stronglyConnectedComponents(SDFGraph *g);
 
+    /**
+     * stronglyConnectedComponents ()
+     * The function determines the strongly connected components in the graph
+     * as index ranges of actor ids (see CSRcomponents).
+     */
+    void stronglyConnectedComponents(SDFGraph *g, CSRcomponents &components);
+
     /**
      * actorInComponent ()
      * The function check wether an actor is in a component. If so, the
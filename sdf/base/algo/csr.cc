@@ -0,0 +1,733 @@
+/*
+ *  TU Eindhoven
+ *  Eindhoven, The Netherlands
+ *
+ *  Name            :   csr.cc
+ *
+ *  Author          :   agent (agent@local)
+ *
+ *  Date            :   October 19, 2026
+ *
+ *  Function        :   Graph algorithms on compressed sparse row adjacency
+ *
+ *  History         :
+ *      19-10-26    :   Initial version.
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, 59 Temple Place - Suite 330, Boston, MA 02111-1307, USA.
+ *
+ * In other words, you are welcome to use, share and improve this program.
+ * You are forbidden to forbid anyone else to use, share and improve
+ * what you give them.   Happy coding!
+ */
+
+
+#include "csr.h"
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+namespace SDF
+{
+    /**
+     * CSRgraph ()
+     * Constructor. The function takes a snapshot of the channels of the SDF
+     * graph g. The graph is transposed when transpose is true.
+     */
+    CSRgraph::CSRgraph(SDFGraph *g, const bool transpose)
+    {
+        v_uint last(g->nrActors(), UINT_MAX);
+
+        offset.assign(g->nrActors() + 1, 0);
+
+        // Number of successors of each actor (parallel channels are merged)
+        for (SDFactorsIter iter = g->actorsBegin(); iter != g->actorsEnd(); iter++)
+        {
+            SDFactor *a = *iter;
+            v_uint adj;
+
+            for (SDFportsIter iterP = a->portsBegin();
+                 iterP != a->portsEnd(); iterP++)
+            {
+                SDFport *p = *iterP;
+                SDFchannel *c = p->getChannel();
+                uint v;
+
+                if (c == NULL)
+                    continue;
+
+                if (!transpose && p->getType() == SDFport::Out)
+                    v = c->getDstActor()->getId();
+                else if (transpose && p->getType() == SDFport::In)
+                    v = c->getSrcActor()->getId();
+                else
+                    continue;
+
+                if (last[v] != a->getId())
+                {
+                    last[v] = a->getId();
+                    offset[a->getId()]++;
+                }
+            }
+        }
+
+        // Offsets of the successor lists
+        for (uint u = 0, e = 0; u <= g->nrActors(); u++)
+        {
+            uint n = offset[u];
+
+            offset[u] = e;
+            e += n;
+        }
+
+        // Successors
+        target.resize(offset[g->nrActors()]);
+        last.assign(g->nrActors(), UINT_MAX);
+        for (SDFactorsIter iter = g->actorsBegin(); iter != g->actorsEnd(); iter++)
+        {
+            SDFactor *a = *iter;
+            uint e = offset[a->getId()];
+
+            for (SDFportsIter iterP = a->portsBegin();
+                 iterP != a->portsEnd(); iterP++)
+            {
+                SDFport *p = *iterP;
+                SDFchannel *c = p->getChannel();
+                uint v;
+
+                if (c == NULL)
+                    continue;
+
+                if (!transpose && p->getType() == SDFport::Out)
+                    v = c->getDstActor()->getId();
+                else if (transpose && p->getType() == SDFport::In)
+                    v = c->getSrcActor()->getId();
+                else
+                    continue;
+
+                if (last[v] != a->getId())
+                {
+                    last[v] = a->getId();
+                    target[e++] = v;
+                }
+            }
+        }
+    }
+
+    /**
+     * construct ()
+     * The function constructs the graph from a list of edges. Edge i goes from
+     * node src[i] to node dst[i]. The successors of a node are kept in the
+     * order of the list.
+     */
+    void CSRgraph::construct(const uint nrNodes, const v_uint &src,
+                             const v_uint &dst)
+    {
+        offset.assign(nrNodes + 1, 0);
+        target.resize(src.size());
+
+        for (uint i = 0; i < src.size(); i++)
+            offset[src[i] + 1]++;
+        for (uint u = 0; u < nrNodes; u++)
+            offset[u + 1] += offset[u];
+
+        v_uint next(offset.begin(), offset.end() - 1);
+        for (uint i = 0; i < src.size(); i++)
+            target[next[src[i]]++] = dst[i];
+    }
+
+    /**
+     * CSRtarjan
+     * Iterative version of Tarjan's algorithm. The search is restricted to the
+     * nodes u with member[u] equal to the given set. The workspace is reused
+     * over multiple searches on the same graph.
+     */
+    class CSRtarjan
+    {
+        public:
+            // Constructor
+            CSRtarjan(const CSRgraph &graph, const v_uint &m)
+                : g(graph), member(m), index(graph.nrNodes(), UINT_MAX),
+                  lowLink(graph.nrNodes()), component(graph.nrNodes()),
+                  onStack(graph.nrNodes(), false) {};
+
+            // Destructor
+            ~CSRtarjan() {};
+
+            // Strongly connected components of the nodes in the set. The
+            // function returns the number of components.
+            uint run(const v_uint &nodes, const uint set);
+
+            // Component of node u in the last search
+            uint getComponent(const uint u) const
+            {
+                return component[u];
+            };
+
+        private:
+            const CSRgraph &g;
+            const v_uint &member;
+            v_uint index;
+            v_uint lowLink;
+            v_uint component;
+            vector<bool> onStack;
+            v_uint stack;
+            v_uint frameNode;
+            v_uint frameEdge;
+    };
+
+    /**
+     * run ()
+     * The function computes the strongly connected components of the nodes in
+     * the set. The recursion of the depth-first search is replaced by an
+     * explicit stack of (node, next edge) frames. Components are numbered in
+     * the order in which Tarjan's algorithm completes them.
+     */
+    uint CSRtarjan::run(const v_uint &nodes, const uint set)
+    {
+        uint nrIndices = 0, nrComponents = 0;
+
+        for (uint i = 0; i < nodes.size(); i++)
+            index[nodes[i]] = UINT_MAX;
+
+        for (uint i = 0; i < nodes.size(); i++)
+        {
+            uint r = nodes[i];
+
+            if (index[r] != UINT_MAX)
+                continue;
+
+            // Visit root r
+            index[r] = lowLink[r] = nrIndices++;
+            stack.push_back(r);
+            onStack[r] = true;
+            frameNode.push_back(r);
+            frameEdge.push_back(g.beginSuccessors(r));
+
+            while (!frameNode.empty())
+            {
+                uint v = frameNode.back();
+
+                if (frameEdge.back() < g.endSuccessors(v))
+                {
+                    uint w = g.getTarget(frameEdge.back()++);
+
+                    if (member[w] != set)
+                        continue;
+
+                    if (index[w] == UINT_MAX)
+                    {
+                        // Visit successor w
+                        index[w] = lowLink[w] = nrIndices++;
+                        stack.push_back(w);
+                        onStack[w] = true;
+                        frameNode.push_back(w);
+                        frameEdge.push_back(g.beginSuccessors(w));
+                    }
+                    else if (onStack[w] && index[w] < lowLink[v])
+                    {
+                        lowLink[v] = index[w];
+                    }
+                    continue;
+                }
+
+                // All successors of v visited; v is the root of a component?
+                if (lowLink[v] == index[v])
+                {
+                    uint w;
+
+                    do
+                    {
+                        w = stack.back();
+                        stack.pop_back();
+                        onStack[w] = false;
+                        component[w] = nrComponents;
+                    }
+                    while (w != v);
+
+                    nrComponents++;
+                }
+
+                frameNode.pop_back();
+                frameEdge.pop_back();
+                if (!frameNode.empty() && lowLink[v] < lowLink[frameNode.back()])
+                    lowLink[frameNode.back()] = lowLink[v];
+            }
+        }
+
+        return nrComponents;
+    }
+
+    /**
+     * stronglyConnectedComponents ()
+     * The function computes the strongly connected components of the graph g
+     * with an iterative version of Tarjan's algorithm. The components are
+     * numbered on their smallest node afterwards.
+     */
+    void stronglyConnectedComponents(const CSRgraph &g, CSRcomponents &c)
+    {
+        const uint n = g.nrNodes();
+        v_uint member(n, 0), nodes(n);
+        CSRtarjan tarjan(g, member);
+        uint nrComponents;
+
+        for (uint u = 0; u < n; u++)
+            nodes[u] = u;
+        nrComponents = tarjan.run(nodes, 0);
+
+        // Number the components on their smallest node
+        v_uint number(nrComponents, UINT_MAX);
+        uint k = 0;
+
+        c.component.resize(n);
+        for (uint u = 0; u < n; u++)
+        {
+            if (number[tarjan.getComponent(u)] == UINT_MAX)
+                number[tarjan.getComponent(u)] = k++;
+            c.component[u] = number[tarjan.getComponent(u)];
+        }
+
+        // Nodes of each component in increasing order
+        c.begin.assign(nrComponents + 1, 0);
+        for (uint u = 0; u < n; u++)
+            c.begin[c.component[u] + 1]++;
+        for (k = 0; k < nrComponents; k++)
+            c.begin[k + 1] += c.begin[k];
+
+        v_uint next(c.begin.begin(), c.begin.end() - 1);
+        c.nodes.resize(n);
+        for (uint u = 0; u < n; u++)
+            c.nodes[next[c.component[u]]++] = u;
+    }
+
+    /**
+     * CSRjohnsonSearch
+     * State of Johnson's algorithm which is shared by all threads. The search
+     * maintains the non-trivial strongly connected components of the subgraph
+     * induced by the nodes which have not been used as start node. The
+     * smallest node s of such a component is the start node of a search for
+     * cycles. After this search, s is removed from its component and the
+     * strongly connected components of the remaining nodes are added to the
+     * search. Components are independent, so they can be handled by
+     * different threads.
+     */
+    typedef struct _CSRjohnsonSearch
+    {
+        // Graph
+        const CSRgraph *g;
+
+        // Components and a queue of (smallest node, component) pairs
+        vector<v_uint> sets;
+        std::priority_queue<std::pair<uint, uint>,
+            vector<std::pair<uint, uint> >,
+            std::greater<std::pair<uint, uint> > > queue;
+
+        // Number of components which are being handled by a thread
+        uint nrBusy;
+
+        // Enumeration stopped (by a visitor or an error)
+        std::atomic<bool> stop;
+        CString error;
+
+        std::mutex lock;
+        std::condition_variable changed;
+    } CSRjohnsonSearch;
+
+    /**
+     * CSRjohnson
+     * Private state of a thread of Johnson's algorithm. The nodes of the
+     * component handled by the thread are marked with a stamp which is unique
+     * for the component.
+     */
+    class CSRjohnson
+    {
+        public:
+            // Constructor
+            CSRjohnson(CSRjohnsonSearch &s)
+                : search(s), g(*s.g), mark(s.g->nrNodes(), 0),
+                  tarjan(*s.g, mark), blocked(s.g->nrNodes(), false),
+                  blockedBy(s.g->nrNodes()), source(s.g->nrEdges()),
+                  listed(s.g->nrEdges(), false), stamp(0)
+            {
+                for (uint u = 0; u < g.nrNodes(); u++)
+                {
+                    for (uint e = g.beginSuccessors(u);
+                         e < g.endSuccessors(u); e++)
+                    {
+                        source[e] = u;
+                    }
+                }
+            };
+
+            // Destructor
+            ~CSRjohnson() {};
+
+            // Add the components of the graph to the search
+            void start();
+
+            // Handle components till the search is completed
+            void run(CSRcycleVisitor &visitor);
+
+        private:
+            // Add the non-trivial components of a set of nodes to the search
+            void splitSet(const v_uint &nodes);
+
+            // Cycles through node s inside the marked component
+            bool findCycles(const uint s, const v_uint &nodes,
+                            CSRcycleVisitor &visitor);
+
+            // Unblock a node
+            void unblock(const uint u);
+
+            // Remove all edges from the B-list of node w
+            void clearBlockedBy(const uint w);
+
+            CSRjohnsonSearch &search;
+            const CSRgraph &g;
+            v_uint mark;
+            CSRtarjan tarjan;
+            vector<bool> blocked;
+
+            // B-lists of Johnson's algorithm. The B-list of node w contains
+            // the edges (v,w) of the nodes v which must be unblocked together
+            // with w. An edge is listed at most once.
+            vector<v_uint> blockedBy;
+            v_uint source;
+            vector<bool> listed;
+            uint stamp;
+    };
+
+    /**
+     * splitSet ()
+     * The function computes the strongly connected components of the nodes
+     * (which must be marked with the current stamp). Every non-trivial
+     * component (more than one node or a self-loop) is added to the search.
+     */
+    void CSRjohnson::splitSet(const v_uint &nodes)
+    {
+        uint nrComponents = tarjan.run(nodes, stamp);
+        vector<v_uint> components(nrComponents);
+
+        for (uint i = 0; i < nodes.size(); i++)
+            components[tarjan.getComponent(nodes[i])].push_back(nodes[i]);
+
+        for (uint k = 0; k < nrComponents; k++)
+        {
+            v_uint &c = components[k];
+            bool selfLoop = false;
+
+            if (c.size() == 1)
+            {
+                for (uint e = g.beginSuccessors(c[0]); e < g.endSuccessors(c[0]);
+                     e++)
+                {
+                    if (g.getTarget(e) == c[0])
+                        selfLoop = true;
+                }
+            }
+
+            if (c.size() > 1 || selfLoop)
+            {
+                uint minNode = *std::min_element(c.begin(), c.end());
+                std::lock_guard<std::mutex> guard(search.lock);
+
+                search.sets.push_back(v_uint());
+                search.sets.back().swap(c);
+                search.queue.push(std::make_pair(minNode,
+                                                 search.sets.size() - 1));
+                search.changed.notify_one();
+            }
+        }
+    }
+
+    /**
+     * clearBlockedBy ()
+     * The function removes all edges from the B-list of node w.
+     */
+    void CSRjohnson::clearBlockedBy(const uint w)
+    {
+        for (uint i = 0; i < blockedBy[w].size(); i++)
+            listed[blockedBy[w][i]] = false;
+        blockedBy[w].clear();
+    }
+
+    /**
+     * unblock ()
+     * The function unblocks node u and (iteratively) all nodes which were
+     * blocked because of u.
+     */
+    void CSRjohnson::unblock(const uint u)
+    {
+        v_uint todo(1, u);
+
+        blocked[u] = false;
+        while (!todo.empty())
+        {
+            uint v = todo.back();
+            todo.pop_back();
+
+            for (uint i = 0; i < blockedBy[v].size(); i++)
+            {
+                uint w = source[blockedBy[v][i]];
+
+                if (blocked[w])
+                {
+                    blocked[w] = false;
+                    todo.push_back(w);
+                }
+            }
+            clearBlockedBy(v);
+        }
+    }
+
+    /**
+     * findCycles ()
+     * The function finds all cycles through node s inside the marked
+     * component with the given nodes with an iterative depth-first search
+     * (the circuit procedure of Johnson). The function returns false when
+     * the enumeration is stopped.
+     */
+    bool CSRjohnson::findCycles(const uint s, const v_uint &nodes,
+                                CSRcycleVisitor &visitor)
+    {
+        v_uint path, frameEdge;
+        vector<bool> frameFound;
+        bool completed = true;
+
+        blocked[s] = true;
+        path.push_back(s);
+        frameEdge.push_back(g.beginSuccessors(s));
+        frameFound.push_back(false);
+
+        while (!path.empty())
+        {
+            uint v = path.back();
+
+            if (frameEdge.back() < g.endSuccessors(v))
+            {
+                uint w = g.getTarget(frameEdge.back()++);
+
+                if (mark[w] != stamp)
+                    continue;
+
+                if (w == s)
+                {
+                    // Cycle found
+                    frameFound.back() = true;
+                    if (search.stop || !visitor.visitCycle(path))
+                    {
+                        completed = false;
+                        break;
+                    }
+                }
+                else if (!blocked[w])
+                {
+                    // Extend the path with w
+                    blocked[w] = true;
+                    path.push_back(w);
+                    frameEdge.push_back(g.beginSuccessors(w));
+                    frameFound.push_back(false);
+                }
+                continue;
+            }
+
+            // All successors of v explored
+            bool found = frameFound.back();
+
+            if (found)
+            {
+                unblock(v);
+            }
+            else
+            {
+                for (uint e = g.beginSuccessors(v); e < g.endSuccessors(v); e++)
+                {
+                    uint w = g.getTarget(e);
+
+                    // Add v to B(w) when it is not already in it
+                    if (mark[w] == stamp && !listed[e])
+                    {
+                        listed[e] = true;
+                        blockedBy[w].push_back(e);
+                    }
+                }
+            }
+
+            path.pop_back();
+            frameEdge.pop_back();
+            frameFound.pop_back();
+            if (found && !frameFound.empty())
+                frameFound.back() = true;
+        }
+
+        // Reset the nodes of the component
+        for (uint i = 0; i < nodes.size(); i++)
+        {
+            blocked[nodes[i]] = false;
+            clearBlockedBy(nodes[i]);
+        }
+
+        return completed;
+    }
+
+    /**
+     * start ()
+     * The function adds the non-trivial strongly connected components of the
+     * graph to the search.
+     */
+    void CSRjohnson::start()
+    {
+        v_uint nodes(g.nrNodes());
+
+        stamp++;
+        for (uint u = 0; u < g.nrNodes(); u++)
+        {
+            nodes[u] = u;
+            mark[u] = stamp;
+        }
+
+        splitSet(nodes);
+    }
+
+    /**
+     * run ()
+     * The function repeatedly takes the component with the smallest start
+     * node from the search, finds all cycles through its start node and adds
+     * the components of its remaining nodes to the search. The function
+     * returns when no components are left and no other thread can add new
+     * components, or when the enumeration is stopped.
+     */
+    void CSRjohnson::run(CSRcycleVisitor &visitor)
+    {
+        v_uint nodes;
+        uint s;
+
+        while (true)
+        {
+            // Take the next component
+            {
+                std::unique_lock<std::mutex> guard(search.lock);
+
+                while (search.queue.empty() && search.nrBusy > 0
+                       && !search.stop)
+                {
+                    search.changed.wait(guard);
+                }
+
+                if (search.queue.empty() || search.stop)
+                    return;
+
+                s = search.queue.top().first;
+                nodes.swap(search.sets[search.queue.top().second]);
+                v_uint().swap(search.sets[search.queue.top().second]);
+                search.queue.pop();
+                search.nrBusy++;
+            }
+
+            try
+            {
+                stamp++;
+                for (uint i = 0; i < nodes.size(); i++)
+                    mark[nodes[i]] = stamp;
+
+                if (findCycles(s, nodes, visitor))
+                {
+                    // Remove s and split the remaining nodes in components
+                    mark[s] = 0;
+                    nodes.erase(std::find(nodes.begin(), nodes.end(), s));
+                    splitSet(nodes);
+                }
+                else
+                {
+                    search.stop = true;
+                }
+            }
+            catch (CException &e)
+            {
+                std::lock_guard<std::mutex> guard(search.lock);
+                search.error = e.getMessage();
+                search.stop = true;
+            }
+
+            // Component completed
+            {
+                std::lock_guard<std::mutex> guard(search.lock);
+
+                search.nrBusy--;
+                search.changed.notify_all();
+            }
+        }
+    }
+
+    /**
+     * runJohnson ()
+     * Worker thread of the parallel enumeration of simple cycles.
+     */
+    static
+    void runJohnson(CSRjohnsonSearch *search, CSRcycleVisitor *visitor)
+    {
+        CSRjohnson johnson(*search);
+
+        johnson.run(*visitor);
+    }
+
+    /**
+     * findSimpleCycles ()
+     * The function enumerates all simple cycles of the graph g with an
+     * iterative version of Johnson's algorithm. Every cycle is passed to the
+     * visitor once, starting with its smallest node. The cycles are found in
+     * increasing order of their smallest node. The function returns false
+     * when the visitor stopped the enumeration.
+     */
+    bool findSimpleCycles(const CSRgraph &g, CSRcycleVisitor &visitor)
+    {
+        vector<CSRcycleVisitor *> visitors(1, &visitor);
+
+        return findSimpleCycles(g, visitors);
+    }
+
+    /**
+     * findSimpleCycles ()
+     * The function enumerates all simple cycles of the graph g with
+     * visitors.size() threads. The components of Johnson's algorithm are
+     * distributed over the threads; thread i passes its cycles to visitors[i].
+     * The order in which cycles are found depends on the scheduling of the
+     * threads. The enumeration stops as soon as one of the visitors returns
+     * false, in which case the function returns false.
+     */
+    bool findSimpleCycles(const CSRgraph &g,
+                          const vector<CSRcycleVisitor *> &visitors)
+    {
+        CSRjohnsonSearch search;
+        vector<std::thread> threads;
+
+        search.g = &g;
+        search.nrBusy = 0;
+        search.stop = false;
+
+        CSRjohnson johnson(search);
+        johnson.start();
+
+        for (uint t = 1; t < visitors.size(); t++)
+            threads.push_back(std::thread(runJohnson, &search, visitors[t]));
+        johnson.run(*visitors[0]);
+        for (uint t = 0; t < threads.size(); t++)
+            threads[t].join();
+
+        if (!search.error.empty())
+            throw CException(search.error);
+
+        return !search.stop;
+    }
+
+}//namespace SDF
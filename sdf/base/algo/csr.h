@@ -0,0 +1,158 @@
+/*
+ *  TU Eindhoven
+ *  Eindhoven, The Netherlands
+ *
+ *  Name            :   csr.h
+ *
+ *  Author          :   agent (agent@local)
+ *
+ *  Date            :   October 19, 2026
+ *
+ *  Function        :   Graph algorithms on compressed sparse row adjacency
+ *
+ *  History         :
+ *      19-10-26    :   Initial version.
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, 59 Temple Place - Suite 330, Boston, MA 02111-1307, USA.
+ *
+ * In other words, you are welcome to use, share and improve this program.
+ * You are forbidden to forbid anyone else to use, share and improve
+ * what you give them.   Happy coding!
+ */
+
+
+#ifndef SDF_BASE_ALGO_CSR_H_INCLUDED
+#define SDF_BASE_ALGO_CSR_H_INCLUDED
+
+#include "../../../base/base.h"
+#include "../untimed/graph.h"
+namespace SDF
+{
+    /**
+     * CSRgraph
+     * Snapshot of the edges of a directed graph in compressed sparse row
+     * format. The nodes are numbered 0 ... nrNodes()-1. The successors of node
+     * u are getTarget(e) for e in [beginSuccessors(u), endSuccessors(u)).
+     */
+    class CSRgraph
+    {
+        public:
+            // Constructor
+            CSRgraph() {};
+
+            // Snapshot of an SDF graph. Nodes are the actor ids. Parallel
+            // channels between two actors become a single edge.
+            CSRgraph(SDFGraph *g, const bool transpose = false);
+
+            // Destructor
+            ~CSRgraph() {};
+
+            // Construct from a list of edges (src[i] -> dst[i])
+            void construct(const uint nrNodes, const v_uint &src,
+                           const v_uint &dst);
+
+            // Nodes and edges
+            uint nrNodes() const
+            {
+                return offset.empty() ? 0 : offset.size() - 1;
+            };
+            uint nrEdges() const
+            {
+                return target.size();
+            };
+            uint beginSuccessors(const uint u) const
+            {
+                return offset[u];
+            };
+            uint endSuccessors(const uint u) const
+            {
+                return offset[u + 1];
+            };
+            uint getTarget(const uint e) const
+            {
+                return target[e];
+            };
+
+        private:
+            v_uint offset;
+            v_uint target;
+    };
+
+    /**
+     * CSRcomponents
+     * Strongly connected components of a CSRgraph. The nodes of component k
+     * are nodes[begin[k]] ... nodes[begin[k+1]-1] (in increasing order).
+     * Components are ordered on their smallest node. The component of node u
+     * is component[u].
+     */
+    typedef struct _CSRcomponents
+    {
+        v_uint nodes;
+        v_uint begin;
+        v_uint component;
+
+        uint nrComponents() const
+        {
+            return begin.empty() ? 0 : begin.size() - 1;
+        };
+        uint size(const uint k) const
+        {
+            return begin[k + 1] - begin[k];
+        };
+    } CSRcomponents;
+
+    /**
+     * stronglyConnectedComponents ()
+     * The function computes the strongly connected components of the graph g
+     * with an iterative version of Tarjan's algorithm.
+     */
+    void stronglyConnectedComponents(const CSRgraph &g, CSRcomponents &c);
+
+    /**
+     * CSRcycleVisitor
+     * Receives the simple cycles found by findSimpleCycles.
+     */
+    class CSRcycleVisitor
+    {
+        public:
+            // Destructor
+            virtual ~CSRcycleVisitor() {};
+
+            // Called for every simple cycle (nodes in the order of the cycle,
+            // starting with its smallest node). The enumeration stops when the
+            // function returns false.
+            virtual bool visitCycle(const v_uint &cycle) = 0;
+    };
+
+    /**
+     * findSimpleCycles ()
+     * The function enumerates all simple cycles of the graph g with an
+     * iterative version of Johnson's algorithm. Every cycle is passed to the
+     * visitor once, in increasing order of their smallest node. The function
+     * returns false when the visitor stopped the enumeration.
+     */
+    bool findSimpleCycles(const CSRgraph &g, CSRcycleVisitor &visitor);
+
+    /**
+     * findSimpleCycles ()
+     * The function enumerates all simple cycles of the graph g with
+     * visitors.size() threads. Thread i passes its cycles to visitors[i]. The
+     * enumeration stops as soon as one of the visitors returns false, in which
+     * case the function returns false.
+     */
+    bool findSimpleCycles(const CSRgraph &g,
+                          const vector<CSRcycleVisitor *> &visitors);
+
+}//namespace SDF
+#endif
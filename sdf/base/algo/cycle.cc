@@ -35,436 +35,124 @@
 
 #include "cycle.h"
 #include "components.h"
+#include "csr.h"
 
-/*
- *  findSimpleCycles(G):
- *  1 Split graph G(A,C) in a set of strongly connected components S
- *  2 For each s(A',C') in S
- *  3   For each actor a in A'
- *  4     color[a] <- white
- *  5     pi[a] <- NIL
- *  4   For an actor a in A'
- *  5     color[a] <- gray
- *  6     For each actor b in Adj(a, s)
- *  7       pi[b] <- a
- *  8       simpleCycleVisit(a)
- *
- *  simpleCycleVisit(a):
- *  1 color[a] <- gray
- *  2 For each b in Adj(a, s)
- *  3   Do if color[a] = white
- *  4     pi[b] <- a
- *  5     simpleCycleVisit(b)
- *  6   Else if color[a] = gray
- *  7     Create new cycle c
- *  8 color[a] <- white
- */
-
-//#define __FIND_CYCLE_USING_SDFGRAPH__
-#ifdef __FIND_CYCLE_USING_SDFGRAPH__
-/**
- * getAdjacentActors ()
- * The function returns a list with actors directly reachable from
- * actor a (in case transpose if false). If transpose is 'true', the
- * graph is transposed and the function returns a list with actors
- * which are directly reachable from a in the transposed graph.
- */
-static
-SDFactors getAdjacentActors(SDFactor *a, SDFgraphComponent &component,
-                            bool transpose)
+namespace SDF
 {
-    SDFactors actors;
-
-    for (SDFportsIter iter = a->portsBegin(); iter != a->portsEnd(); iter++)
-    {
-        SDFport *p = *iter;
-
-        if (!transpose)
-        {
-            if (p->getType() == SDFport::Out)
-            {
-                SDFactor *b = p->getChannel()->getDstActor();
-
-                if (actorInComponent(b, component))
-                    actors.push_back(b);
-            }
-        }
-        else
-        {
-            if (p->getType() == SDFport::In)
-            {
-                SDFactor *b = p->getChannel()->getSrcActor();
-
-                if (actorInComponent(b, component))
-                    actors.push_back(b);
-            }
-        }
-    }
-
-    return actors;
-}
 
-/**
- * simpleCycleVisit ()
- * The visitor function of the DFS based algorithm used for detecting
- * simple cycles.
- */
-static
-void simpleCycleVisit(SDFactor *a, v_int &color, SDFactor **pi,
-                      bool transpose, SDFgraphComponent &component, SDFgraphCycles &cycles)
-{
-    // color[a] <- gray
-    color[a->getId()] = 1;
 
-    // for each b in Adj(e)
-    SDFactors adj = getAdjacentActors(a, component, transpose);
-    for (SDFactorsIter iter = adj.begin(); iter != adj.end(); iter++)
+    /**
+     * SDFactorCycleVisitor
+     * Translates the cycles found on the CSR snapshot of an SDF graph into
+     * cycles of actors.
+     */
+    class SDFactorCycleVisitor : public CSRcycleVisitor
     {
-        SDFactor *b = *iter;
-
-        // do if color[b] = white
-        if (color[b->getId()] == 0)
-        {
-            pi[b->getId()] = a;
-            simpleCycleVisit(b, color, pi, transpose, component, cycles);
-        }
-        else if (color[b->getId()] == 1)
-        {
-            SDFgraphCycle cycle;
-
-            // Create new cycle
-            cycle.push_front(a);
-
-            SDFactor *u = a;
-            while (u->getId() != b->getId())
+        public:
+            // Constructor
+            SDFactorCycleVisitor(SDFGraph *g, SDFgraphCycleVisitor &v)
+                : actors(g->nrActors()), visitor(v)
             {
-                u = pi[u->getId()];
-                if (u != NULL)
-                    cycle.push_front(u);
-            }
-
-            // Add cycle to list of cycles
-            cycles.insert(cycle);
-        }
-    }
-
-    // color[a] <- white
-    color[a->getId()] = 0;
-}
-
-/**
- * findSimpleCycles ()
- * The function performs a depth first search on the graph to discover all
- * simple cycles in the graph
- */
-SDFgraphCycles findSimpleCycles(SDFGraph *g, bool transpose)
-{
-    SDFgraphCycles cycles;
-    SDFactor **pi = new SDFactor* [g->nrActors()];
-
-    // Split graph in strongly connected components
-    SDFgraphComponents components = stronglyConnectedComponents(g);
-
-    // Iterate over all components
-    for (SDFgraphComponentsIter iter = components.begin();
-         iter != components.end(); iter++)
-    {
-        SDFgraphComponent &component = *iter;
-
-        // For each a in A' do color[a] <- white
-        v_int color(g->nrActors(), 0);
-
-        // For each a in A' do pi[a] <- NIL
-        for (uint a = 0; a < g->nrActors(); a++)
-            pi[a] = NULL;
-
-        // For an actor a in A' (take the first actor)
-        SDFactor *a = component.front();
-
-        // color[a] <- gray
-        color[a->getId()] = 1;
+                for (SDFactorsIter iter = g->actorsBegin();
+                     iter != g->actorsEnd(); iter++)
+                {
+                    actors[(*iter)->getId()] = *iter;
+                }
+            };
 
-        // For each actor b in Adj(a, s)
-        SDFactors adj = getAdjacentActors(a, component, transpose);
-        for (SDFactorsIter iterA = adj.begin(); iterA != adj.end(); iterA++)
-        {
-            SDFactor *b = *iterA;
+            // Destructor
+            virtual ~SDFactorCycleVisitor() {};
 
-            if (color[b->getId()] == 0)
-            {
-                pi[b->getId()] = a;
-                simpleCycleVisit(b, color, pi, transpose, component, cycles);
-            }
-            else if (color[b->getId()] == 1)
+            // Visit a cycle
+            virtual bool visitCycle(const v_uint &c)
             {
-                // Self-loop
-                SDFgraphCycle cycle;
+                cycle.resize(c.size());
+                for (uint i = 0; i < c.size(); i++)
+                    cycle[i] = actors[c[i]];
 
-                cycle.push_front(a);
-                cycles.insert(cycle);
-            }
-        }
-    }
-
-    // Cleanup
-    delete [] pi;
-
-    return cycles;
-}
-
-#else // __FIND_CYCLE_USING_SDFGRAPH__
-
-#include "graph.h"
-namespace SDF
-{
+                return visitor.visitCycle(cycle);
+            };
 
+        private:
+            vector<SDFactor *> actors;
+            vector<SDFactor *> cycle;
+            SDFgraphCycleVisitor &visitor;
+    };
 
     /**
-     * getAdjacentActors ()
-     * The function returns a list with actors directly reachable from
-     * actor a.
+     * SDFgraphCycleCollector
+     * Collects (the first maxNrCycles) cycles in a set of cycles.
      */
-    static
-    v_uint getAdjacentActors(uint a, v_uint &nodeId, v_uint &actorId,
-                             vector<v_uint> &graph, uint nrNodes)
+    class SDFgraphCycleCollector : public SDFgraphCycleVisitor
     {
-        v_uint actors;
+        public:
+            // Constructor
+            SDFgraphCycleCollector(SDFgraphCycles &c,
+                                   const uint max = UINT_MAX)
+                : cycles(c), maxNrCycles(max) {};
 
-        uint u = nodeId[a];
-        for (uint v = 0; v < nrNodes; v++)
-        {
-            if (graph[u][v] == 1)
-                actors.push_back(actorId[v]);
-        }
-
-        return actors;
-    }
-
-    /**
-     * simpleCycleVisit ()
-     * The visitor function of the DFS based algorithm used for detecting
-     * simple cycles.
-     */
-    static
-    void simpleCycleVisit(uint a, SDFGraph *g, v_uint &nodeId, v_uint &actorId,
-                          vector<v_uint> &graph, uint size, v_int &color, v_uint &pi,
-                          SDFgraphCycles &cycles)
-    {
-        // color[a] <- gray
-        color[a] = 1;
+            // Destructor
+            virtual ~SDFgraphCycleCollector() {};
 
-        // for each b in Adj(e)
-        v_uint adj = getAdjacentActors(a, nodeId, actorId, graph, size);
-        for (uint i = 0; i < adj.size(); i++)
-        {
-            uint b = adj[i];
-
-            // do if color[b] = white
-            if (color[b] == 0)
-            {
-                pi[b] = a;
-                simpleCycleVisit(b, g, nodeId, actorId, graph, size, color, pi,
-                                 cycles);
-            }
-            else if (color[b] == 1)
+            // Visit a cycle
+            virtual bool visitCycle(const vector<SDFactor *> &c)
             {
-                SDFgraphCycle cycle;
+                cycles.insert(SDFgraphCycle(c.begin(), c.end()));
 
-                // Create new cycle
-                cycle.push_front(g->getActor(a));
+                return cycles.size() < maxNrCycles;
+            };
 
-                uint u = a;
-                while (u != b)
-                {
-                    u = pi[u];
-                    cycle.push_front(g->getActor(u));
-                }
-
-                // Add cycle to list of cycles
-                cycles.insert(cycle);
-            }
-        }
-
-        // color[a] <- white
-        color[a] = 0;
-    }
+        private:
+            SDFgraphCycles &cycles;
+            uint maxNrCycles;
+    };
 
     /**
      * findSimpleCycles ()
-     * The function performs a depth first search on the graph to discover all
-     * simple cycles in the graph
+     * The function enumerates all simple cycles in the graph (Johnson's
+     * algorithm on a CSR snapshot of the graph). Every cycle is passed to the
+     * visitor without storing it. The function returns false when the visitor
+     * stopped the enumeration.
      */
-    SDFgraphCycles findSimpleCycles(SDFGraph *g, bool transpose)
+    bool findSimpleCycles(SDFGraph *g, SDFgraphCycleVisitor &visitor,
+                          bool transpose)
     {
-        SDFgraphCycles cycles;
-        v_uint pi(g->nrActors());
-
-        // Split graph in strongly connected components
-        SDFgraphComponents components = stronglyConnectedComponents(g);
-
-        // Iterate over all components
-        for (SDFgraphComponentsIter iter = components.begin();
-             iter != components.end(); iter++)
-        {
-            v_uint actorId, nodeId;
-            vector<v_uint> graph;
-            SDFgraphComponent &component = *iter;
-
-            // Convert component to graph structure
-            sdfComponentToGraph(g, component, nodeId, actorId, graph, transpose);
-
-            // For each a in A' do color[a] <- white
-            v_int color(g->nrActors(), 0);
+        CSRgraph csr(g, transpose);
+        SDFactorCycleVisitor v(g, visitor);
 
-            // For each a in A' do pi[a] <- NIL
-            for (uint a = 0; a < g->nrActors(); a++)
-                pi[a] = 0;
-
-            // For an actor a in A' (take the first actor)
-            uint a = actorId[0];
-
-            // color[a] <- gray
-            color[a] = 1;
-
-            // For each actor b in Adj(a, s)
-            v_uint adj = getAdjacentActors(a, nodeId, actorId, graph,
-                                           component.size());
-            for (uint i = 0; i < adj.size(); i++)
-            {
-                uint b = adj[i];
-
-                if (color[b] == 0)
-                {
-                    pi[b] = a;
-                    simpleCycleVisit(b, g, nodeId, actorId, graph, component.size(),
-                                     color, pi, cycles);
-                }
-                else if (color[b] == 1)
-                {
-                    // Self-loop
-                    SDFgraphCycle cycle;
-
-                    cycle.push_front(g->getActor(a));
-                    cycles.insert(cycle);
-                }
-            }
-        }
-
-        return cycles;
+        return findSimpleCycles(csr, v);
     }
 
     /**
-     * simpleCycleVisit ()
-     * The visitor function of the DFS based algorithm used for detecting
-     * simple cycles.
+     * findSimpleCycles ()
+     * The function returns all simple cycles in the graph.
      */
-    static
-    void simpleCycleVisit(uint a, SDFGraph *g, v_uint &nodeId, v_uint &actorId,
-                          vector<v_uint> &graph, uint size, v_int &color, v_uint &pi,
-                          SDFgraphCycle &cycle)
+    SDFgraphCycles findSimpleCycles(SDFGraph *g, bool transpose)
     {
-        // color[a] <- gray
-        color[a] = 1;
-
-        // for each b in Adj(e)
-        v_uint adj = getAdjacentActors(a, nodeId, actorId, graph, size);
-        for (uint i = 0; i < adj.size(); i++)
-        {
-            uint b = adj[i];
-
-            // do if color[b] = white
-            if (color[b] == 0)
-            {
-                pi[b] = a;
-                simpleCycleVisit(b, g, nodeId, actorId, graph, size, color, pi,
-                                 cycle);
-            }
-            else if (color[b] == 1)
-            {
-                // Create new cycle
-                cycle.push_front(g->getActor(a));
-
-                uint u = a;
-                while (u != b)
-                {
-                    u = pi[u];
-                    cycle.push_front(g->getActor(u));
-                }
-            }
+        SDFgraphCycles cycles;
+        SDFgraphCycleCollector collector(cycles);
 
-            // Found a cycle?
-            if (cycle.size() != 0)
-                break;
-        }
+        findSimpleCycles(g, collector, transpose);
 
-        // color[a] <- white
-        color[a] = 0;
+        return cycles;
     }
 
     /**
      * findSimpleCycle ()
-     * The function performs a depth first search on the graph to discover a
-     * simple cycles in the graph. The first cycle found is returned.
+     * The function returns the first simple cycle found in the graph (an
+     * empty cycle when the graph is acyclic).
      */
     SDFgraphCycle findSimpleCycle(SDFGraph *g, bool transpose)
     {
-        SDFgraphCycle cycle;
-        v_uint pi(g->nrActors());
-
-        // Split graph in strongly connected components
-        SDFgraphComponents components = stronglyConnectedComponents(g);
-
-        // Iterate over all components
-        for (SDFgraphComponentsIter iter = components.begin();
-             iter != components.end(); iter++)
-        {
-            v_uint actorId, nodeId;
-            vector<v_uint> graph;
-            SDFgraphComponent &component = *iter;
-
-            // Convert component to graph structure
-            sdfComponentToGraph(g, component, nodeId, actorId, graph, transpose);
-
-            // For each a in A' do color[a] <- white
-            v_int color(g->nrActors(), 0);
-
-            // For each a in A' do pi[a] <- NIL
-            for (uint a = 0; a < g->nrActors(); a++)
-                pi[a] = 0;
-
-            // For an actor a in A' (take the first actor)
-            uint a = actorId[0];
-
-            // color[a] <- gray
-            color[a] = 1;
-
-            // For each actor b in Adj(a, s)
-            v_uint adj = getAdjacentActors(a, nodeId, actorId, graph,
-                                           component.size());
-            for (uint i = 0; i < adj.size(); i++)
-            {
-                uint b = adj[i];
+        SDFgraphCycles cycles;
+        SDFgraphCycleCollector collector(cycles, 1);
 
-                if (color[b] == 0)
-                {
-                    pi[b] = a;
-                    simpleCycleVisit(b, g, nodeId, actorId, graph, component.size(),
-                                     color, pi, cycle);
-                }
-                else if (color[b] == 1)
-                {
-                    // Self-loop
-                    cycle.push_front(g->getActor(a));
-                }
+        findSimpleCycles(g, collector, transpose);
 
-                // Found a cycle?
-                if (cycle.size() != 0)
-                    return cycle;
-            }
-        }
+        if (cycles.empty())
+            return SDFgraphCycle();
 
-        return cycle;
+        return *cycles.begin();
     }
 
-#endif // __FIND_CYCLE_USING_SDFGRAPH__
 }//namespace SDF
@@ -137,17 +137,42 @@ namespace SDF
     typedef SDFgraphCycles::iterator                SDFgraphCyclesIter;
     typedef SDFgraphCycles::const_iterator          SDFgraphCyclesCIter;
 
+    /**
+     * SDFgraphCycleVisitor
+     * Receives the simple cycles found by findSimpleCycles.
+     */
+    class SDFgraphCycleVisitor
+    {
+        public:
+            // Destructor
+            virtual ~SDFgraphCycleVisitor() {};
+
+            // Called for every simple cycle (actors in the order of the
+            // cycle, starting with the actor with the smallest id). The
+            // enumeration stops when the function returns false.
+            virtual bool visitCycle(const vector<SDFactor *> &cycle) = 0;
+    };
+
+    /**
+     * findSimpleCycles ()
+     * The function enumerates all simple cycles in the graph (Johnson's
+     * algorithm on a CSR snapshot of the graph). Every cycle is passed to the
+     * visitor without storing it. The function returns false when the visitor
+     * stopped the enumeration.
+     */
+    bool findSimpleCycles(SDFGraph *g, SDFgraphCycleVisitor &visitor,
+                          bool transpose = false);
+
     /**
      * findSimpleCycles ()
-     * The function performs a depth first search on the graph to discover all
-     * simple cycles in the graph
+     * The function returns all simple cycles in the graph.
      */
     SDFgraphCycles findSimpleCycles(SDFGraph *g, bool transpose = false);
 
     /**
      * findSimpleCycle ()
-     * The function performs a depth first search on the graph to discover a
-     * simple cycles in the graph. The first cycle found is returned.
+     * The function returns the first simple cycle found in the graph (an
+     * empty cycle when the graph is acyclic).
      */
     SDFgraphCycle findSimpleCycle(SDFGraph *g, bool transpose = false);
 
@@ -34,113 +34,172 @@
  */
 
 #include "repetition_vector.h"
+#include <climits>
 namespace SDF
 {
 
 
     /**
-     * calcFractionsConnectedActors ()
-     * The function calculates and firing ration (as fractions) of
-     * all actors connected to actor 'a' based on its firing rate. In case
-     * of an inconsistent graph, all fractions are set to 0.
+     * multiplyRates ()
+     * The function returns the product of a and b. An exception is thrown when
+     * the product does not fit in 64 bits.
      */
     static
-    void calcFractionsConnectedActors(CFractions &fractions, SDFactor *a)
+    unsigned long long multiplyRates(const unsigned long long a,
+                                     const unsigned long long b)
     {
-        CFraction fractionA = fractions[a->getId()];
+        if (a != 0 && b > ULLONG_MAX / a)
+            throw CException("Repetition vector does not fit in 64 bits.");
 
-        // Inconsistent graph?
-        if (fractionA == CFraction(0, 0))
-            return;
-
-        // Calculate the rate for each actor 'b' connected to actor 'a'
-        for (SDFportsIter iter = a->portsBegin(); iter != a->portsEnd(); iter++)
-        {
-            SDFport *pA = *iter;
-
-            // Get actor 'b' on other side of channel and its port 'pB'
-            SDFchannel *c = pA->getChannel();
-            SDFport *pB = c->getSrcPort();
-            SDFactor *b = pB->getActor();
-            if (a->getId() == b->getId())
-            {
-                pB = c->getDstPort();
-                b = pB->getActor();
-            }
+        return a * b;
+    }
 
-            // Calculate firing rate 'b'
-            CFraction ratioAB = CFraction(pA->getRate(), pB->getRate());
-            CFraction fractionB = fractionA * ratioAB;
+    /**
+     * calcFractionsComponent ()
+     * The function calculates the firing ratio (num/den) of all actors in the
+     * connected component of actor 'a' relative to the firing rate of 'a'. The
+     * component is traversed breadth-first. Its actors are appended to the
+     * queue. Each fraction is reduced when it is computed. The consistency of
+     * the rates is not checked.
+     */
+    static
+    void calcFractionsComponent(SDFactor *a, vector<unsigned long long> &num,
+                                vector<unsigned long long> &den, vector<SDFactor *> &queue)
+    {
+        num[a->getId()] = 1;
+        den[a->getId()] = 1;
+        queue.push_back(a);
 
-            // Known firing rate for 'b'
-            CFraction knownFractionB = fractions[b->getId()];
+        for (uint i = queue.size() - 1; i < queue.size(); i++)
+        {
+            SDFactor *u = queue[i];
+            unsigned long long numU = num[u->getId()];
+            unsigned long long denU = den[u->getId()];
 
-            // Compare known and calculated firing rate of 'b'
-            if (knownFractionB != CFraction(0, 1)
-                && fractionB != knownFractionB)
+            for (SDFportsIter iter = u->portsBegin(); iter != u->portsEnd(); iter++)
             {
-                // Inconsistent graph, set all fractions to 0
-                for (uint i = 0; i < fractions.size(); i++)
-                    fractions[i] = CFraction(0, 0);
+                SDFport *pU = *iter;
+                SDFchannel *c = pU->getChannel();
 
-                return;
-            }
-            else if (knownFractionB == CFraction(0, 1))
-            {
-                // Set the firing rate of actor 'b'
-                fractions[b->getId()] = fractionB;
+                // Get actor 'v' on other side of channel and its port 'pV'
+                if (c == NULL)
+                    continue;
+                SDFport *pV = (c->getSrcPort() == pU ? c->getDstPort()
+                               : c->getSrcPort());
+                SDFactor *v = pV->getActor();
 
-                // Calculate firing rate for all actors connnected to 'b'
-                calcFractionsConnectedActors(fractions, b);
+                if (num[v->getId()] != 0 || pU->getRate() == 0
+                    || pV->getRate() == 0)
+                {
+                    continue;
+                }
 
-                // Is graph inconsistent?
-                if (fractions[b->getId()] == CFraction(0, 0))
-                    return;
+                // Firing ratio of 'v' is (numU/denU) * (rateU/rateV)
+                unsigned long long g1 = gcd<unsigned long long>(numU, pV->getRate());
+                unsigned long long g2 = gcd<unsigned long long>(pU->getRate(), denU);
+                num[v->getId()] = multiplyRates(numU / g1, pU->getRate() / g2);
+                den[v->getId()] = multiplyRates(denU / g2, pV->getRate() / g1);
+                queue.push_back(v);
             }
         }
     }
 
     /**
-     * calcRepetitionVector ()
-     * Convert the fractions to the smallest integers.
+     * calcRepetitionVectorComponent ()
+     * The function converts the fractions of the actors in the queue with
+     * index first or higher to the smallest integers.
      */
     static
-    RepetitionVector calcRepetitionVector(CFractions &fractions)
+    void calcRepetitionVectorComponent(const vector<SDFactor *> &queue,
+                                       const uint first, const vector<unsigned long long> &num,
+                                       const vector<unsigned long long> &den,
+                                       RepetitionVector &repetitionVector)
     {
-        RepetitionVector repetitionVector(fractions.size(), 0);
-        long long int l = 1;
+        unsigned long long l = 1, g = 0;
+        vector<unsigned long long> entries(queue.size() - first);
 
         // Find lowest common multiple (lcm) of all denominators
-        for (CFractionsIter iter = fractions.begin();
-             iter != fractions.end(); iter++)
+        for (uint i = first; i < queue.size(); i++)
         {
-            CFraction &f = *iter;
+            unsigned long long d = den[queue[i]->getId()];
 
-            l = lcm(l, f.denominator());
+            l = multiplyRates(l / gcd(l, d), d);
         }
 
-        // Zero vector?
-        if (l == 0)
-            return repetitionVector;
+        // Scale the fractions to integers and find their greatest common
+        // divisor (gcd)
+        for (uint i = first; i < queue.size(); i++)
+        {
+            CId id = queue[i]->getId();
+
+            entries[i - first] = multiplyRates(num[id], l / den[id]);
+            g = gcd(g, entries[i - first]);
+        }
 
-        // Calculate non-zero repetition vector
-        for (uint i = 0; i < fractions.size(); i++)
+        // Minimize the entries using the gcd
+        for (uint i = first; i < queue.size(); i++)
         {
-            repetitionVector[i] = (int)
-                                  ((fractions[i].numerator() * l) / fractions[i].denominator());
+            unsigned long long e = entries[i - first] / g;
+
+            if (e > INT_MAX)
+            {
+                throw CException("Repetition vector entry of actor '"
+                                 + queue[i]->getName() + "' does not fit in "
+                                 "an int.");
+            }
+
+            repetitionVector[queue[i]->getId()] = (int)e;
         }
+    }
+
+    /**
+     * calcRepetitionVector ()
+     * The function computes the repetition vector of an SDFG. The entries of
+     * each connected component are the smallest integers which balance the
+     * rates of its channels. The function returns a zero vector when the graph
+     * is inconsistent.
+     */
+    static
+    RepetitionVector calcRepetitionVector(SDFGraph *g)
+    {
+        RepetitionVector repetitionVector(g->nrActors(), 0);
+        vector<unsigned long long> num(g->nrActors(), 0);
+        vector<unsigned long long> den(g->nrActors(), 1);
+        vector<SDFactor *> queue;
+
+        queue.reserve(g->nrActors());
 
-        // Find greatest common divisor (gcd)
-        int g = repetitionVector[0];
-        for (uint i = 1; i < repetitionVector.size(); i++)
+        // Firing ratios and repetition vector of each connected component
+        for (SDFactorsIter iter = g->actorsBegin(); iter != g->actorsEnd(); iter++)
         {
-            g = gcd(g, repetitionVector[i]);
+            SDFactor *a = *iter;
+            uint first = queue.size();
+
+            if (num[a->getId()] != 0)
+                continue;
+
+            calcFractionsComponent(a, num, den, queue);
+            calcRepetitionVectorComponent(queue, first, num, den,
+                                          repetitionVector);
         }
 
-        // Minimize the repetition vector using the gcd
-        for (uint i = 0; i < repetitionVector.size(); i++)
+        // Rates of all channels must be balanced (products fit in 64 bits as
+        // the entries fit in an int and the rates in an uint)
+        for (SDFchannelsIter iter = g->channelsBegin();
+             iter != g->channelsEnd(); iter++)
         {
-            repetitionVector[i] = repetitionVector[i] / g;
+            SDFchannel *c = *iter;
+            SDFport *src = c->getSrcPort();
+            SDFport *dst = c->getDstPort();
+            unsigned long long produced, consumed;
+
+            produced = (unsigned long long)repetitionVector[src->getActor()->getId()]
+                       * src->getRate();
+            consumed = (unsigned long long)repetitionVector[dst->getActor()->getId()]
+                       * dst->getRate();
+
+            if (produced != consumed || produced == 0)
+                return RepetitionVector(g->nrActors(), 0);
         }
 
         return repetitionVector;
@@ -148,27 +207,61 @@ namespace SDF
 
     /**
      * computeRepetitionVector ()
-     * The function computes the repetition vector of an SDFG.
+     * The function computes the repetition vector of an SDFG. The result is
+     * cached on the graph. An exception is thrown when an entry of the
+     * repetition vector does not fit in an int.
      */
     RepetitionVector computeRepetitionVector(SDFGraph *g)
     {
-        CFractions fractions(g->nrActors(), CFraction(0, 1));
+        typedef SDFgraphCache::Value<RepetitionVector> CachedRepetitionVector;
+        SDFgraphCache::Artifact *cached;
 
-        // Calculate firing ratio (as fraction) for each actor
+        cached = g->getCache().lookup(SDFgraphCache::RepetitionVectorArtifact);
+        if (cached != NULL)
+            return ((CachedRepetitionVector *)cached)->value;
+
+        RepetitionVector repetitionVector = calcRepetitionVector(g);
+        g->getCache().store(SDFgraphCache::RepetitionVectorArtifact,
+                            new CachedRepetitionVector(repetitionVector));
+
+        return repetitionVector;
+    }
+
+    /**
+     * selectOutputActor ()
+     * The function returns the first actor with the lowest entry in the
+     * repetition vector of the graph. The result is cached on the graph.
+     */
+    SDFactor *selectOutputActor(SDFGraph *g)
+    {
+        typedef SDFgraphCache::Value<SDFactor *> CachedOutputActor;
+        SDFgraphCache::Artifact *cached;
+        RepetitionVector repVec;
+        int min = INT_MAX;
+        SDFactor *a = NULL;
+
+        cached = g->getCache().lookup(SDFgraphCache::OutputActorArtifact);
+        if (cached != NULL)
+            return ((CachedOutputActor *)cached)->value;
+
+        // Select actor with lowest entry in repetition vector
+        repVec = computeRepetitionVector(g);
         for (SDFactorsIter iter = g->actorsBegin(); iter != g->actorsEnd(); iter++)
         {
-            SDFactor *a = *iter;
-            CFraction &f = fractions[a->getId()];
-
-            if (f == CFraction(0, 1))
+            if (repVec[(*iter)->getId()] < min)
             {
-                f = CFraction(1, 1);
-                calcFractionsConnectedActors(fractions, a);
+                a = *iter;
+                min = repVec[a->getId()];
             }
         }
 
-        // Calculate repetition vector based on firing ratios
-        return calcRepetitionVector(fractions);
+        if (a != NULL)
+        {
+            g->getCache().store(SDFgraphCache::OutputActorArtifact,
+                                new CachedOutputActor(a));
+        }
+
+        return a;
     }
 
     /**
@@ -180,7 +273,7 @@ namespace SDF
     {
         RepetitionVector repVec = computeRepetitionVector(g);
 
-        if (repVec[0] == 0)
+        if (repVec.empty() || repVec[0] == 0)
             return false;
 
         return true;
@@ -49,10 +49,20 @@ namespace SDF
 
     /**
      * computeRepetitionVector ()
-     * The function computes the repetition vector of an SDFG.
+     * The function computes the repetition vector of an SDFG. The entries of
+     * each connected component are minimal. A zero vector is returned when the
+     * graph is inconsistent. The result is cached on the graph.
      */
     RepetitionVector computeRepetitionVector(SDFGraph *g);
 
+    /**
+     * selectOutputActor ()
+     * The function returns the first actor with the lowest entry in the
+     * repetition vector. This actor is used as output actor of the state-space
+     * analyses. The result is cached on the graph.
+     */
+    SDFactor *selectOutputActor(SDFGraph *g);
+
     /**
      * isSDFgraphConsistent ()
      * The function checks the consistency of the SDFG and returns true when
@@ -34,9 +34,37 @@
  */
 
 #include "actor.h"
+#include <mutex>
 namespace SDF
 {
+    /**
+     * Processor types
+     * The ids of the processor types. The ids are shared by all actors, also
+     * when the actors belong to different graphs. The table is only used when
+     * a processor is added to or removed from an actor. Processors are looked
+     * up without it (see getProcessor).
+     */
+    static map<CString, uint> processorTypeIds;
+    static std::mutex processorTypeIdsLock;
+
+    /**
+     * getProcessorTypeId ()
+     * The function returns the id of the processor type. A new id is assigned
+     * to a processor type which is not seen before.
+     */
+    uint TimedSDFactor::getProcessorTypeId(const CString &proc)
+    {
+        std::lock_guard<std::mutex> guard(processorTypeIdsLock);
+        map<CString, uint>::iterator iter = processorTypeIds.find(proc);
 
+        if (iter != processorTypeIds.end())
+            return iter->second;
+
+        uint id = processorTypeIds.size();
+        processorTypeIds[proc] = id;
+
+        return id;
+    }
 
     /**
      * TimedSDFactor ()
@@ -46,6 +74,7 @@ namespace SDF
         :
         SDFactor(c)
     {
+        defaultProcessorPtr = NULL;
     }
 
     /**
@@ -175,44 +204,18 @@ namespace SDF
         }
     }
 
-    /**
-     * getExecutionTime ()
-     * The function returns the execution time of the actor on the default
-     * processor.
-     */
-    SDFtime TimedSDFactor::getExecutionTime()
-    {
-        if (defaultProcessor.empty())
-            return 0;
-
-        for (ProcessorsIter iter = processorsBegin();
-             iter != processorsEnd(); iter++)
-        {
-            Processor *p = *iter;
-
-            if (p->type == defaultProcessor)
-                return p->execTime;
-        }
-
-        return SDFTIME_MAX;
-    }
-
     /**
      * getExecutionTime ()
      * The function returns the execution time of the actor on the processor.
      */
     SDFtime TimedSDFactor::getExecutionTime(const CString &proc)
     {
-        for (ProcessorsIter iter = processorsBegin();
-             iter != processorsEnd(); iter++)
-        {
-            Processor *p = *iter;
+        Processor *p = getProcessor(proc);
 
-            if (p->type == proc)
-                return p->execTime;
-        }
+        if (p == NULL)
+            return SDFTIME_MAX;
 
-        return SDFTIME_MAX;
+        return p->execTime;
     }
 
     /**
@@ -222,19 +225,10 @@ namespace SDF
      */
     CSize TimedSDFactor::getStateSize()
     {
-        if (defaultProcessor.empty())
+        if (defaultProcessorPtr == NULL)
             return CSIZE_MAX;
 
-        for (ProcessorsIter iter = processorsBegin();
-             iter != processorsEnd(); iter++)
-        {
-            Processor *p = *iter;
-
-            if (p->type == defaultProcessor)
-                return p->stateSize;
-        }
-
-        return CSIZE_MAX;
+        return defaultProcessorPtr->stateSize;
     }
 
     /**
@@ -243,21 +237,19 @@ namespace SDF
      */
     CSize TimedSDFactor::getStateSize(const CString &proc)
     {
-        for (ProcessorsIter iter = processorsBegin();
-             iter != processorsEnd(); iter++)
-        {
-            Processor *p = *iter;
+        Processor *p = getProcessor(proc);
 
-            if (p->type == proc)
-                return p->stateSize;
-        }
+        if (p == NULL)
+            return CSIZE_MAX;
 
-        return CSIZE_MAX;
+        return p->stateSize;
     }
 
     /**
      * getProcessor ()
-     * Get properties of actor for specified processor type
+     * Get properties of actor for specified processor type. The processors of
+     * the actor are searched directly, so the lookup does not need the shared
+     * table of processor types. The first processor of the type is returned.
      */
     TimedSDFactor::Processor *TimedSDFactor::getProcessor(const CString &proc)
     {
@@ -273,6 +265,26 @@ namespace SDF
         return NULL;
     }
 
+    /**
+     * indexProcessor ()
+     * The function adds the processor to the index of processors unless the
+     * actor has an other processor of the same type. When the processor has
+     * the default processor type, it becomes the default processor (unless
+     * there is already one).
+     */
+    void TimedSDFactor::indexProcessor(Processor *p)
+    {
+        uint id = getProcessorTypeId(p->type);
+
+        if (id >= processorIndex.size())
+            processorIndex.resize(id + 1, NULL);
+        if (processorIndex[id] == NULL)
+            processorIndex[id] = p;
+
+        if (p->type == defaultProcessor && defaultProcessorPtr == NULL)
+            defaultProcessorPtr = p;
+    }
+
     /**
      * addProcessor ()
      * Add a processor type to the list of processor types the actor can be mapped
@@ -294,6 +306,8 @@ namespace SDF
 
         // Add p to list of processors supported by the actor
         processors.push_back(p);
+        indexProcessor(p);
+        markGraphModified();
 
         return p;
     }
@@ -319,6 +333,19 @@ namespace SDF
 
         // Add pa to list of processors supported by the actor
         processors.push_back(pa);
+        indexProcessor(pa);
+        markGraphModified();
+    }
+
+    /**
+     * setDefaultProcessor ()
+     * The function sets the processor type the actor is mapped to.
+     */
+    void TimedSDFactor::setDefaultProcessor(const CString &p)
+    {
+        defaultProcessor = p;
+        defaultProcessorPtr = getProcessor(p);
+        markGraphModified();
     }
 
     /**
@@ -337,6 +364,12 @@ namespace SDF
             {
                 delete p;
                 processors.erase(iter);
+
+                // Next processor of the same type (if any) takes its place
+                processorIndex[getProcessorTypeId(proc)] = getProcessor(proc);
+                defaultProcessorPtr = getProcessor(defaultProcessor);
+
+                markGraphModified();
                 return;
             }
         }
@@ -77,7 +77,14 @@ namespace SDF
             void setProperties(const CNodePtr propertiesNode);
 
             // Execution time
-            SDFtime getExecutionTime();
+            SDFtime getExecutionTime()
+            {
+                if (defaultProcessor.empty())
+                    return 0;
+                if (defaultProcessorPtr == NULL)
+                    return SDFTIME_MAX;
+                return defaultProcessorPtr->execTime;
+            };
             SDFtime getExecutionTime(const CString &proc);
 
             // State size
@@ -86,6 +93,12 @@ namespace SDF
 
             // Processor
             Processor *getProcessor(const CString &proc);
+            Processor *getProcessor(const uint procTypeId)
+            {
+                if (procTypeId >= processorIndex.size())
+                    return NULL;
+                return processorIndex[procTypeId];
+            };
             Processor *addProcessor(const CString &proc);
             void addProcessor(const Processor *p);
             void removeProcessor(const CString &proc);
@@ -115,10 +128,10 @@ namespace SDF
             {
                 return defaultProcessor;
             };
-            void setDefaultProcessor(const CString &p)
-            {
-                defaultProcessor = p;
-            };
+            void setDefaultProcessor(const CString &p);
+
+            // Processor types are identified by a small integer id
+            static uint getProcessorTypeId(const CString &proc);
 
             // Print
             ostream &print(ostream &out);
@@ -128,9 +141,16 @@ namespace SDF
             };
 
         private:
+            // Processor types
+            void indexProcessor(Processor *p);
+
             // Processor
             Processors processors;
             CString defaultProcessor;
+
+            // Processors indexed by their type id and default processor
+            vector<Processor *> processorIndex;
+            Processor *defaultProcessorPtr;
     };
 
 }//namespace SDF
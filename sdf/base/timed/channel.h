@@ -82,6 +82,7 @@ namespace SDF
             void setBufferSize(const BufferSize s)
             {
                 bufferSize = s;
+                markGraphModified();
             };
             bool isUnbounded() const;
             TimedSDFchannel *getStorageSpaceChannel() const
@@ -91,6 +92,7 @@ namespace SDF
             void setStorageSpaceChannel(TimedSDFchannel *c)
             {
                 modelStorageSpaceCh = c;
+                markGraphModified();
             };
             bool modelsStorageSpace() const
             {
@@ -105,6 +107,7 @@ namespace SDF
             void setMinBandwidth(const double b)
             {
                 minBandwidth = b;
+                markGraphModified();
             };
 
             // Token size
@@ -115,6 +118,7 @@ namespace SDF
             void setTokenSize(const int s)
             {
                 tokenSize = s;
+                markGraphModified();
             };
             bool isControlToken() const;
             bool isDataToken() const;
@@ -127,6 +131,7 @@ namespace SDF
             void setTokenType(const CString &type)
             {
                 tokenType = type;
+                markGraphModified();
             };
 
             // Latency
@@ -137,6 +142,7 @@ namespace SDF
             void setMinLatency(const SDFtime t)
             {
                 minLatency = t;
+                markGraphModified();
             };
 
             // Print
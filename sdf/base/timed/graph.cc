@@ -84,6 +84,9 @@ namespace SDF
     {
         TimedSDFgraph *g = createCopy(c);
 
+        // Components of the copy are placed in its arena
+        SDFarena::Scope arenaScope(g->createArena());
+
         // Actors
         for (SDFactorsCIter iter = actorsBegin(); iter != actorsEnd(); iter++)
         {
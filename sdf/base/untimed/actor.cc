@@ -34,6 +34,7 @@
  */
 
 #include "actor.h"
+#include "graph.h"
 namespace SDF
 {
 
@@ -243,6 +244,39 @@ namespace SDF
         throw CException("Actor '" + getName() + "' has no port '" + name + "'.");
     }
 
+    /**
+     * removePort ()
+     * Remove a port from an actor and destroy its memory space. The search
+     * starts at the most recently added port.
+     */
+    void SDFactor::removePort(SDFport *p)
+    {
+        for (SDFportsIter iter = ports.end(); iter != ports.begin();)
+        {
+            iter--;
+
+            if (*iter == p)
+            {
+                delete p;
+                ports.erase(iter);
+                return;
+            }
+        }
+
+        throw CException("Actor '" + getName() + "' has no port '"
+                         + p->getName() + "'.");
+    }
+
+    /**
+     * markGraphModified ()
+     * The function notifies the graph which contains the actor of a change.
+     */
+    void SDFactor::markGraphModified()
+    {
+        if (getGraph() != NULL)
+            getGraph()->markModified();
+    }
+
     /**
      * print ()
      * Print the actor to the supplied output stream.
@@ -97,6 +97,7 @@ namespace SDF
             };
             void addPort(SDFport *p);
             void removePort(const CString &name);
+            void removePort(SDFport *p);
             virtual SDFport *createPort(SDFcomponent &c);
             SDFport *createPort(const SDFport::SDFportType type, const SDFrate rate);
 
@@ -116,6 +117,10 @@ namespace SDF
                 return a.print(out);
             };
 
+        protected:
+            // Structural or timing change of the graph
+            void markGraphModified();
+
         private:
             // Type
             CString type;
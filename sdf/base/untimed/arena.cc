@@ -0,0 +1,124 @@
+/*
+ *  TU Eindhoven
+ *  Eindhoven, The Netherlands
+ *
+ *  Name            :   arena.cc
+ *
+ *  Author          :   agent (agent@local)
+ *
+ *  Date            :   October 19, 2026
+ *
+ *  Function        :   Arena for the components of an SDF graph
+ *
+ *  History         :
+ *      19-10-26    :   Initial version.
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, 59 Temple Place - Suite 330, Boston, MA 02111-1307, USA.
+ *
+ * In other words, you are welcome to use, share and improve this program.
+ * You are forbidden to forbid anyone else to use, share and improve
+ * what you give them.   Happy coding!
+ */
+
+
+#include "arena.h"
+#include <cstdlib>
+#include <new>
+namespace SDF
+{
+    /**
+     * Arena active on the calling thread
+     */
+    static thread_local SDFarena *currentArena = NULL;
+
+    /**
+     * Scope ()
+     * Constructor. The arena a becomes the active arena of the calling thread.
+     */
+    SDFarena::Scope::Scope(SDFarena *a)
+    {
+        previous = currentArena;
+        currentArena = a;
+    }
+
+    /**
+     * ~Scope ()
+     * Destructor. The previously active arena becomes active again.
+     */
+    SDFarena::Scope::~Scope()
+    {
+        currentArena = previous;
+    }
+
+    /**
+     * current ()
+     * The function returns the arena which is active on the calling thread.
+     */
+    SDFarena *SDFarena::current()
+    {
+        return currentArena;
+    }
+
+    /**
+     * ~SDFarena ()
+     * Destructor. All memory of the arena is released.
+     */
+    SDFarena::~SDFarena()
+    {
+        for (uint i = 0; i < blocks.size(); i++)
+            free(blocks[i]);
+    }
+
+    /**
+     * allocate ()
+     * The function returns sz bytes of memory from the arena. Requests larger
+     * than the block size get a block of their own.
+     */
+    void *SDFarena::allocate(size_t sz)
+    {
+        const size_t align = alignof(std::max_align_t);
+        char *p;
+
+        sz = (sz + align - 1) / align * align;
+
+        if (sz > left)
+        {
+            size_t szBlock = (sz > blockSize ? sz : blockSize);
+
+            p = (char *)malloc(szBlock);
+            if (p == NULL)
+                throw std::bad_alloc();
+            blocks.push_back(p);
+
+            // Keep the remainder of the current block when the request gets
+            // a block of its own
+            if (szBlock == sz && left != 0)
+            {
+                allocated += sz;
+                return p;
+            }
+
+            next = p;
+            left = szBlock;
+        }
+
+        p = next;
+        next += sz;
+        left -= sz;
+        allocated += sz;
+
+        return p;
+    }
+
+}//namespace SDF
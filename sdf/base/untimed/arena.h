@@ -0,0 +1,111 @@
+/*
+ *  TU Eindhoven
+ *  Eindhoven, The Netherlands
+ *
+ *  Name            :   arena.h
+ *
+ *  Author          :   agent (agent@local)
+ *
+ *  Date            :   October 19, 2026
+ *
+ *  Function        :   Arena for the components of an SDF graph
+ *
+ *  History         :
+ *      19-10-26    :   Initial version.
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, 59 Temple Place - Suite 330, Boston, MA 02111-1307, USA.
+ *
+ * In other words, you are welcome to use, share and improve this program.
+ * You are forbidden to forbid anyone else to use, share and improve
+ * what you give them.   Happy coding!
+ */
+
+
+#ifndef SDF_BASE_UNTIMED_ARENA_H_INCLUDED
+#define SDF_BASE_UNTIMED_ARENA_H_INCLUDED
+
+#include "../../../base/basic_types.h"
+#include <cstddef>
+namespace SDF
+{
+    /**
+     * SDFarena
+     * Memory of the components (actors, ports and channels) of one graph. The
+     * components are placed contiguously in large blocks. Deleting a component
+     * runs its destructor, but its memory is only released when the arena is
+     * destroyed (in one step, together with the graph which owns the arena).
+     * Components are placed in the arena while a Scope of the arena is active
+     * on the calling thread.
+     */
+    class SDFarena
+    {
+        public:
+            /**
+             * Scope
+             * Components created by the calling thread during the lifetime of
+             * the scope are allocated in the arena.
+             */
+            class Scope
+            {
+                public:
+                    // Constructor
+                    Scope(SDFarena *a);
+
+                    // Destructor
+                    ~Scope();
+
+                private:
+                    SDFarena *previous;
+            };
+
+        public:
+            // Constructor
+            SDFarena(const size_t blockSize = 65536)
+            {
+                this->blockSize = blockSize;
+                next = NULL;
+                left = 0;
+                allocated = 0;
+            };
+
+            // Destructor
+            ~SDFarena();
+
+            // Allocate memory (aligned for any type)
+            void *allocate(size_t sz);
+
+            // Number of bytes allocated in the arena
+            size_t size() const
+            {
+                return allocated;
+            };
+
+            // Arena active on the calling thread (NULL when none)
+            static SDFarena *current();
+
+        private:
+            // Blocks of memory
+            vector<char *> blocks;
+            size_t blockSize;
+
+            // Free space in the last block
+            char *next;
+            size_t left;
+
+            // Number of bytes allocated
+            size_t allocated;
+    };
+
+}//namespace SDF
+#endif
@@ -0,0 +1,240 @@
+/*
+ *  TU Eindhoven
+ *  Eindhoven, The Netherlands
+ *
+ *  Name            :   cache.cc
+ *
+ *  Author          :   agent (agent@local)
+ *
+ *  Date            :   October 19, 2026
+ *
+ *  Function        :   Cache of artifacts derived from an SDF graph
+ *
+ *  History         :
+ *      19-10-26    :   Initial version.
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, 59 Temple Place - Suite 330, Boston, MA 02111-1307, USA.
+ *
+ * In other words, you are welcome to use, share and improve this program.
+ * You are forbidden to forbid anyone else to use, share and improve
+ * what you give them.   Happy coding!
+ */
+
+
+#include "cache.h"
+#include <atomic>
+namespace SDF
+{
+    /**
+     * Hits and misses per type of artifact (over all caches)
+     */
+    static std::atomic<unsigned long> hits[SDFgraphCache::NrArtifactTypes];
+    static std::atomic<unsigned long> misses[SDFgraphCache::NrArtifactTypes];
+
+    /**
+     * SDFgraphCache ()
+     * Constructor.
+     */
+    SDFgraphCache::SDFgraphCache()
+    {
+        version = 0;
+
+        for (uint t = 0; t < NrArtifactTypes; t++)
+        {
+            artifacts[t] = NULL;
+            versions[t] = 0;
+        }
+    }
+
+    /**
+     * SDFgraphCache ()
+     * Constructor. The artifacts of the copied cache are not copied.
+     */
+    SDFgraphCache::SDFgraphCache(const SDFgraphCache &)
+        :
+        SDFgraphCache()
+    {
+    }
+
+    /**
+     * operator= ()
+     * The artifacts of the assigned cache are not copied. All artifacts of
+     * this cache are removed.
+     */
+    SDFgraphCache &SDFgraphCache::operator=(const SDFgraphCache &)
+    {
+        clear();
+        invalidate();
+
+        return *this;
+    }
+
+    /**
+     * ~SDFgraphCache ()
+     * Destructor.
+     */
+    SDFgraphCache::~SDFgraphCache()
+    {
+        clear();
+    }
+
+    /**
+     * clear ()
+     * The function removes all artifacts from the cache.
+     */
+    void SDFgraphCache::clear()
+    {
+        for (uint t = 0; t < NrArtifactTypes; t++)
+        {
+            delete artifacts[t];
+            artifacts[t] = NULL;
+        }
+    }
+
+    /**
+     * save ()
+     * The function moves all artifacts and the version of this cache into
+     * the cache saved. This cache is left without artifacts.
+     */
+    void SDFgraphCache::save(SDFgraphCache &saved)
+    {
+        saved.clear();
+
+        for (uint t = 0; t < NrArtifactTypes; t++)
+        {
+            saved.artifacts[t] = artifacts[t];
+            saved.versions[t] = versions[t];
+            artifacts[t] = NULL;
+        }
+        saved.version = version;
+    }
+
+    /**
+     * restore ()
+     * The function removes all artifacts from this cache and moves the
+     * artifacts and version of the cache saved (see save) back into it. It
+     * must only be used when the graph has the same structure and timing as
+     * when the cache was saved.
+     */
+    void SDFgraphCache::restore(SDFgraphCache &saved)
+    {
+        clear();
+
+        for (uint t = 0; t < NrArtifactTypes; t++)
+        {
+            artifacts[t] = saved.artifacts[t];
+            versions[t] = saved.versions[t];
+            saved.artifacts[t] = NULL;
+        }
+        version = saved.version;
+    }
+
+    /**
+     * lookup ()
+     * The function returns the artifact of type t. It returns NULL when no
+     * artifact of this type has been stored in the current version of the
+     * graph. An outdated artifact is removed.
+     */
+    SDFgraphCache::Artifact *SDFgraphCache::lookup(const ArtifactType t)
+    {
+        if (artifacts[t] != NULL && versions[t] == version)
+        {
+            hits[t]++;
+            return artifacts[t];
+        }
+
+        misses[t]++;
+
+        delete artifacts[t];
+        artifacts[t] = NULL;
+
+        return NULL;
+    }
+
+    /**
+     * store ()
+     * The function stores the artifact a as artifact of type t in the current
+     * version of the graph. The cache takes ownership of a.
+     */
+    void SDFgraphCache::store(const ArtifactType t, Artifact *a)
+    {
+        if (artifacts[t] != a)
+            delete artifacts[t];
+
+        artifacts[t] = a;
+        versions[t] = version;
+    }
+
+    /**
+     * getHits ()
+     * The function returns the number of lookups of an artifact of type t that
+     * were served from a cache.
+     */
+    unsigned long SDFgraphCache::getHits(const ArtifactType t)
+    {
+        return hits[t];
+    }
+
+    /**
+     * getMisses ()
+     * The function returns the number of lookups of an artifact of type t that
+     * could not be served from a cache.
+     */
+    unsigned long SDFgraphCache::getMisses(const ArtifactType t)
+    {
+        return misses[t];
+    }
+
+    /**
+     * getArtifactName ()
+     * The function returns the name of the artifact type t.
+     */
+    CString SDFgraphCache::getArtifactName(const ArtifactType t)
+    {
+        switch (t)
+        {
+            case RepetitionVectorArtifact:
+                return "repetition vector";
+            case ComponentsArtifact:
+                return "strongly connected components";
+            case OutputActorArtifact:
+                return "output actor";
+            case MinimalChannelSizesArtifact:
+                return "minimal channel sizes";
+            case HSDFgraphArtifact:
+                return "HSDF graph";
+            default:
+                break;
+        }
+
+        return "unknown";
+    }
+
+    /**
+     * printStatistics ()
+     * The function prints the number of hits and misses of all artifact types.
+     */
+    void SDFgraphCache::printStatistics(ostream &out)
+    {
+        out << "Graph cache:" << endl;
+        for (uint t = 0; t < NrArtifactTypes; t++)
+        {
+            ArtifactType type = (ArtifactType)t;
+
+            out << " [" << getArtifactName(type) << "] hits: ";
+            out << getHits(type) << ", misses: " << getMisses(type) << endl;
+        }
+    }
+
+}//namespace SDF
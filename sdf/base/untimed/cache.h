@@ -0,0 +1,136 @@
+/*
+ *  TU Eindhoven
+ *  Eindhoven, The Netherlands
+ *
+ *  Name            :   cache.h
+ *
+ *  Author          :   agent (agent@local)
+ *
+ *  Date            :   October 19, 2026
+ *
+ *  Function        :   Cache of artifacts derived from an SDF graph
+ *
+ *  History         :
+ *      19-10-26    :   Initial version.
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, 59 Temple Place - Suite 330, Boston, MA 02111-1307, USA.
+ *
+ * In other words, you are welcome to use, share and improve this program.
+ * You are forbidden to forbid anyone else to use, share and improve
+ * what you give them.   Happy coding!
+ */
+
+
+#ifndef SDF_BASE_UNTIMED_CACHE_H_INCLUDED
+#define SDF_BASE_UNTIMED_CACHE_H_INCLUDED
+
+#include "../../../base/basic_types.h"
+#include "../../../base/string/cstring.h"
+namespace SDF
+{
+    /**
+     * SDFgraphCache
+     * Artifacts derived from a graph (e.g. its repetition vector or its strongly
+     * connected components). The cache has a version which is incremented on
+     * every structural or timing change of the graph. An artifact is only
+     * served in the version in which it was stored. Hits and misses are
+     * counted per type of artifact over all caches.
+     */
+    class SDFgraphCache
+    {
+        public:
+            // Types of artifacts
+            enum ArtifactType
+            {
+                RepetitionVectorArtifact,
+                ComponentsArtifact,
+                OutputActorArtifact,
+                MinimalChannelSizesArtifact,
+                HSDFgraphArtifact,
+                NrArtifactTypes
+            };
+
+            /**
+             * Artifact
+             * Data stored in the cache. The cache owns its artifacts.
+             */
+            class Artifact
+            {
+                public:
+                    // Destructor
+                    virtual ~Artifact() {};
+            };
+
+            /**
+             * Value
+             * Artifact which holds a copy of a value of type T.
+             */
+            template <class T>
+            class Value : public Artifact
+            {
+                public:
+                    // Constructor
+                    Value(const T &v) : value(v) {};
+
+                    T value;
+            };
+
+        public:
+            // Constructor
+            SDFgraphCache();
+
+            // A copy of a cache is empty
+            SDFgraphCache(const SDFgraphCache &c);
+            SDFgraphCache &operator=(const SDFgraphCache &c);
+
+            // Destructor
+            ~SDFgraphCache();
+
+            // Version
+            unsigned long getVersion() const
+            {
+                return version;
+            };
+            void invalidate()
+            {
+                version++;
+            };
+
+            // Artifacts (lookup returns NULL when the artifact is missing)
+            Artifact *lookup(const ArtifactType t);
+            void store(const ArtifactType t, Artifact *a);
+            void clear();
+
+            // Set the artifacts and version aside during a temporary change of
+            // the graph and bring them back when the change is undone
+            void save(SDFgraphCache &saved);
+            void restore(SDFgraphCache &saved);
+
+            // Statistics
+            static unsigned long getHits(const ArtifactType t);
+            static unsigned long getMisses(const ArtifactType t);
+            static CString getArtifactName(const ArtifactType t);
+            static void printStatistics(ostream &out);
+
+        private:
+            // Artifacts and the version in which they were stored
+            Artifact *artifacts[NrArtifactTypes];
+            unsigned long versions[NrArtifactTypes];
+
+            // Version of the graph
+            unsigned long version;
+    };
+
+}//namespace SDF
+#endif
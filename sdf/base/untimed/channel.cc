@@ -232,6 +232,16 @@ namespace SDF
         return true;
     }
 
+    /**
+     * markGraphModified ()
+     * The function notifies the graph which contains the channel of a change.
+     */
+    void SDFchannel::markGraphModified()
+    {
+        if (getGraph() != NULL)
+            getGraph()->markModified();
+    }
+
     /**
      * print ()
      * Print the channel to the supplied output stream.
@@ -97,6 +97,7 @@ namespace SDF
             void setInitialTokens(const uint t)
             {
                 initialTokens = t;
+                markGraphModified();
             };
 
             // Properties
@@ -115,6 +116,10 @@ namespace SDF
                 return c.print(out);
             };
 
+        protected:
+            // Structural or timing change of the graph
+            void markGraphModified();
+
         private:
             SDFport *src;
             SDFport *dst;
@@ -61,4 +61,56 @@ namespace SDF
         name(name)
     {
     }
+
+    /**
+     * Size of the header in front of every component. The header contains the
+     * arena in which the component is allocated.
+     */
+    static const size_t componentHeaderSize = alignof(std::max_align_t);
+
+    /**
+     * allocate ()
+     * The function allocates memory for a component in the arena a or on the
+     * heap when a is NULL.
+     */
+    void *SDFcomponent::allocate(size_t sz, SDFarena *a)
+    {
+        char *p;
+
+        if (a == NULL)
+            p = (char *)::operator new(sz + componentHeaderSize);
+        else
+            p = (char *)a->allocate(sz + componentHeaderSize);
+
+        *(SDFarena **)p = a;
+
+        return p + componentHeaderSize;
+    }
+
+    /**
+     * operator new ()
+     * The function allocates memory for a component in the arena which is
+     * active on the calling thread or on the heap when no arena is active.
+     */
+    void *SDFcomponent::operator new(size_t sz)
+    {
+        return allocate(sz, SDFarena::current());
+    }
+
+    /**
+     * operator delete ()
+     * The function releases the memory of a component which is allocated on
+     * the heap. Memory in an arena is released together with the arena.
+     */
+    void SDFcomponent::operator delete(void *p)
+    {
+        char *b;
+
+        if (p == NULL)
+            return;
+
+        b = (char *)p - componentHeaderSize;
+        if (*(SDFarena **)b == NULL)
+            ::operator delete(b);
+    }
 }//namespace SDF
@@ -40,6 +40,7 @@
 #include "../../../base/basic_types.h"
 #include "../../basic_types.h"
 #include "../../../base/string/cstring.h"
+#include "arena.h"
 namespace SDF
 {
 
@@ -62,6 +63,10 @@ namespace SDF
             // Desctructor
             virtual ~SDFcomponent() {};
 
+            // Allocation (in the arena active on the calling thread)
+            static void *operator new(size_t sz);
+            static void operator delete(void *p);
+
             // Information
             CId getId() const
             {
@@ -84,6 +89,10 @@ namespace SDF
                 name = n;
             };
 
+        protected:
+            // Allocation in the arena a (on the heap when a is NULL)
+            static void *allocate(size_t sz, SDFarena *a);
+
         private:
             // Information
             SDFcomponent *parent;
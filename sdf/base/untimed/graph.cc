@@ -44,7 +44,8 @@ namespace SDF
      */
     SDFGraph::SDFGraph(SDFcomponent &c)
         :
-        SDFcomponent(c)
+        SDFcomponent(c),
+        arena(nullptr)
     {
     }
 
@@ -54,7 +55,8 @@ namespace SDF
      */
     SDFGraph::SDFGraph()
         :
-        SDFcomponent()
+        SDFcomponent(),
+        arena(nullptr)
     {
     }
 
@@ -75,6 +77,23 @@ namespace SDF
         {
             delete c;
         }
+
+        // Memory of the components in the arena
+        delete arena;
+    }
+
+    /**
+     * createArena ()
+     * The function returns the arena of the graph. The arena is created when
+     * the graph has no arena yet. Components which are allocated while a scope
+     * of the arena is active are released together with the graph.
+     */
+    SDFarena *SDFGraph::createArena()
+    {
+        if (arena == nullptr)
+            arena = new SDFarena;
+
+        return arena;
     }
 
     /**
@@ -95,6 +114,9 @@ namespace SDF
     {
         auto *g = new SDFGraph(c);
 
+        // Components of the copy are placed in its arena
+        SDFarena::Scope arenaScope(g->createArena());
+
         // Properties
         g->setName(getName());
         g->setType(getType());
@@ -224,6 +246,7 @@ namespace SDF
      */
     void SDFGraph::addActor(SDFactor *a)
     {
+        markModified();
         actors.push_back(a);
     }
 
@@ -239,6 +262,7 @@ namespace SDF
 
             if (a->getName() == name)
             {
+                markModified();
                 actors.erase(iter);
                 return;
             }
@@ -310,6 +334,7 @@ namespace SDF
      */
     void SDFGraph::addChannel(SDFchannel *c)
     {
+        markModified();
         channels.push_back(c);
     }
 
@@ -327,6 +352,7 @@ namespace SDF
             if (c->getName() == name)
             {
                 delete c;
+                markModified();
                 channels.erase(iter);
                 return;
             }
@@ -336,6 +362,30 @@ namespace SDF
                          + "' has no channel '" + name + "'.");
     }
 
+    /**
+     * removeChannel ()
+     * Remove a channel from a graph and destroy its memory space. The search
+     * starts at the most recently added channel.
+     */
+    void SDFGraph::removeChannel(SDFchannel *c)
+    {
+        for (auto iter = channels.end(); iter != channels.begin();)
+        {
+            iter--;
+
+            if (*iter == c)
+            {
+                delete c;
+                markModified();
+                channels.erase(iter);
+                return;
+            }
+        }
+
+        throw CException("Graph '" + getName()
+                         + "' has no channel '" + c->getName() + "'.");
+    }
+
     /**
      * createChannel ()
      * Create a new channel on the graph.
@@ -37,6 +37,7 @@
 #define SDF_BASE_UNTIMED_GRAPH_H_INCLUDED
 
 #include "channel.h"
+#include "cache.h"
 namespace SDF
 {
 
@@ -56,6 +57,36 @@ namespace SDF
             // Destructor
             ~SDFGraph() override;
 
+            // Graphs are always allocated on the heap
+            static void *operator new(size_t sz)
+            {
+                return allocate(sz, NULL);
+            };
+            static void operator delete(void *p)
+            {
+                SDFcomponent::operator delete(p);
+            };
+
+            // Arena in which components of the graph can be allocated (see
+            // SDFarena::Scope)
+            SDFarena *getArena() const
+            {
+                return arena;
+            };
+            SDFarena *createArena();
+
+            // Artifacts derived from the graph
+            SDFgraphCache &getCache()
+            {
+                return cache;
+            };
+
+            // Structural or timing change of the graph (invalidates the cache)
+            void markModified()
+            {
+                cache.invalidate();
+            };
+
             // Construct
             virtual SDFGraph *create(SDFcomponent &c) const;
             virtual SDFGraph *createCopy(SDFcomponent &c) const;
@@ -129,6 +160,7 @@ namespace SDF
             };
             void addChannel(SDFchannel *c);
             void removeChannel(const CString &name);
+            void removeChannel(SDFchannel *c);
             virtual SDFchannel *createChannel(SDFcomponent &c);
             SDFchannel *createChannel(SDFactor *src, SDFrate rateSrc, SDFactor *dst,
                                       SDFrate rateDst, uint initialTokens);
@@ -148,6 +180,12 @@ namespace SDF
             SDFactors   actors;
             SDFchannels channels;
 
+            // Arena of the components (NULL when not used)
+            SDFarena *arena;
+
+            // Artifacts derived from the graph
+            SDFgraphCache cache;
+
     };
 
     typedef list<SDFGraph *>            SDFgraphs;
@@ -34,6 +34,7 @@
  */
 
 #include "port.h"
+#include "graph.h"
 namespace SDF
 {
 
@@ -137,6 +138,29 @@ namespace SDF
                              + "." + getName() + "' already connected.");
 
         channel = c;
+        markGraphModified();
+    }
+
+    /**
+     * setRate ()
+     * The function sets the rate of the port.
+     */
+    void SDFport::setRate(const SDFrate r)
+    {
+        rate = r;
+        markGraphModified();
+    }
+
+    /**
+     * markGraphModified ()
+     * The function notifies the graph which contains the port of a change.
+     */
+    void SDFport::markGraphModified()
+    {
+        SDFactor *a = getActor();
+
+        if (a != NULL && a->getGraph() != NULL)
+            a->getGraph()->markModified();
     }
 
     /**
@@ -106,10 +106,7 @@ namespace SDF
             {
                 return rate;
             };
-            void setRate(const SDFrate r)
-            {
-                rate = r;
-            };
+            void setRate(const SDFrate r);
 
             // Channel
             SDFchannel *getChannel() const
@@ -134,6 +131,10 @@ namespace SDF
                 return p.print(out);
             };
 
+        protected:
+            // Structural change of the graph which contains the port
+            void markGraphModified();
+
         private:
             SDFportType type;
             SDFrate     rate;
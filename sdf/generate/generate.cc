@@ -39,13 +39,24 @@
 #include "../base/algo/graph.h"
 #include "../analysis/analysis.h"
 #include "../transform/hsdf/hsdf.h"
-#include "../transform/model/buffersize.h"
-#include "../transform/model/autoconc.h"
+#include "../transform/model/overlay.h"
 
 namespace SDF
 {
-    // Random number generator
-    static MTRand mtRand;
+    // Random number generator (every thread owns a generator, which allows
+    // multiple graphs to be generated concurrently)
+    static thread_local MTRand mtRand;
+
+    /**
+     * seedSDFgraphGenerator ()
+     * Seed the random number generator used by the calling thread. Graphs
+     * generated after seeding with the same value are identical, irrespective
+     * of the thread that generates them.
+     */
+    void seedSDFgraphGenerator(const uint seed)
+    {
+        mtRand.seed(seed);
+    }
 
     /**
      * relabelSDFgraph ()
@@ -87,6 +98,9 @@ namespace SDF
 
             id++;
         }
+
+        // Cached artifacts refer to the old actor ids
+        g->markModified();
     }
 
     /**
@@ -1335,39 +1349,22 @@ namespace SDF
                                     const double throughputScaleFactor)
     {
         SDFstateSpaceThroughputAnalysis thrAnalysisAlgo;
-        TimedSDFgraph *ga, *gb;
-        SDFcomponent component;
+        TimedSDFgraphOverlay overlay(g);
         double thr;
 
         // Auto-concurrency limited?
         if (autoConcurrencyDegree != 0)
-        {
-            ga = (TimedSDFgraph *)modelAutoConcurrencyInSDFgraph(g,
-                    autoConcurrencyDegree);
-        }
-        else
-        {
-            component = SDFcomponent(g->getParent(), g->getId(), g->getName());
-            ga = g->clone(component);
-        }
+            overlay.modelAutoConcurrency(autoConcurrencyDegree);
 
         // Buffer size channels limited?
         if (bufferSize)
-        {
-            gb = modelBufferSizeInSDFgraph(ga);
-            thr = thrAnalysisAlgo.analyze(gb);
-            delete gb;
-        }
-        else
-        {
-            thr = thrAnalysisAlgo.analyze(ga);
-        }
+            overlay.modelBufferSize();
+
+        thr = thrAnalysisAlgo.analyze(g);
+        overlay.restore();
 
         // Set throughput constraint
         g->setThroughputConstraint(throughputScaleFactor * mtRand.rand()*thr);
-
-        // Cleanup
-        delete ga;
     }
 
     /**
@@ -40,6 +40,12 @@
 
 namespace SDF
 {
+    /**
+     * seedSDFgraphGenerator ()
+     * Seed the random number generator of the calling thread.
+     */
+    void seedSDFgraphGenerator(const uint seed);
+
     /**
      * generateSDFgraph ()
      * Generate a random SDF graph.
@@ -55,7 +55,8 @@ namespace SDF
         // Extract channel related binding and scheduling properties
         extractChannelMapping(constrainedSDFG, platformGraph);
 
-        // Create a binding-aware SDFG
+        // Create a binding-aware SDFG (its components are placed in its arena)
+        SDFarena::Scope arenaScope(createArena());
         constructBindingAwareSDFG(constrainedSDFG, platformGraph, flowType);
     }
 
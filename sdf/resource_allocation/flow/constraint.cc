@@ -36,7 +36,7 @@
 #include "flow.h"
 #include "../../analysis/analysis.h"
 #include "../../base/algo/cycle.h"
-#include "../../transform/model/buffersize.h"
+#include "../../transform/model/overlay.h"
 namespace SDF
 {
     /**
@@ -47,7 +47,8 @@ namespace SDF
     void SDF3Flow::estimateLatencyConstraints()
     {
         double throughputDist = selectedStorageDistribution->thr;
-        TimedSDFgraph *storageAppGraph;
+        TimedSDFgraphOverlay overlay(getAppGraph());
+        TimedSDFgraph *storageAppGraph = overlay.getGraph();
         RepetitionVector repVec;
         SDFgraphCycles cycles;
         double **channelWeight;
@@ -67,7 +68,7 @@ namespace SDF
         }
 
         // Model storage constraints in the graph
-        storageAppGraph = modelBufferSizeInSDFgraph(getAppGraph());
+        overlay.modelBufferSize();
 
         // Compute repetition vector
         repVec = computeRepetitionVector(storageAppGraph);
@@ -145,6 +146,9 @@ namespace SDF
         // Find all simple cycles in the graph
         cycles = findSimpleCycles(storageAppGraph);
 
+        // The latencies are set on the channels of the original graph
+        overlay.restore();
+
         // Compute the cycle mean for each cycle and the latency for all channels on
         // the cycle
         for (SDFgraphCyclesIter iter = cycles.begin(); iter != cycles.end(); iter++)
@@ -238,7 +242,6 @@ namespace SDF
             delete [] channelWeight[i];
         delete [] channelWeight;
         delete [] actorWeight;
-        delete storageAppGraph;
 
         // Advance to next state in the flow
         setNextStateOfFlow(FlowEstimateBandwidthConstraint);
@@ -55,6 +55,9 @@ namespace SDF
         // Run flow in one go
         stepMode = false;
 
+        // Output flat static-order schedules
+        loopedSchedules = false;
+
         // Application graph
         appGraph = createAppGraph(xmlAppGraph);
 
@@ -390,7 +393,8 @@ namespace SDF
 
         // Mapping node (to platform graph and to interconnect)
         mappingNode = CAddNode(sdf3Node,
-                               createMappingNode(platformGraph, appGraph));
+                               createMappingNode(platformGraph, appGraph,
+                                                 loopedSchedules));
         if (nocMapping != NULL)
             CAddNode(mappingNode, nocMapping->createMappingNode());
 
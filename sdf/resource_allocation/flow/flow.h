@@ -98,6 +98,27 @@ namespace SDF
                 stepMode = flag;
             };
 
+            // Directory in which the storage-space / throughput exploration is
+            // cached (no caching when empty)
+            CString getStorageDistributionCache() const
+            {
+                return storageDistributionCache;
+            };
+            void setStorageDistributionCache(const CString &dir)
+            {
+                storageDistributionCache = dir;
+            };
+
+            // Output static-order schedules with loops
+            bool getLoopedSchedules() const
+            {
+                return loopedSchedules;
+            };
+            void setLoopedSchedules(bool flag)
+            {
+                loopedSchedules = flag;
+            };
+
             // Settings for tile binding and scheduling phase
             void setTileMappingAlgo(TileMapping *a)
             {
@@ -158,6 +179,9 @@ namespace SDF
             void scheduleCommunication();
             void updateBandwidthAllocations();
 
+            // Storage-space / throughput exploration
+            StorageDistributionSet *findNextStorageDistributionSet();
+
             // User interaction when running flow in step-by-step mode
             void handleUserInteraction();
 
@@ -195,6 +219,14 @@ namespace SDF
             // Storage-space / throughput exploration algorithm
             SDFstateSpaceBufferAnalysis bufferAnalysisAlgo;
 
+            // Cache of the storage-space / throughput exploration (directory and
+            // file used for the application graph)
+            CString storageDistributionCache;
+            CString storageDistributionCacheFile;
+
+            // Output static-order schedules with loops
+            bool loopedSchedules;
+
             // Minimal storage distributions
             StorageDistributionSet *minStorageDistributions;
             StorageDistributionSet *selectedStorageDistributionSet;
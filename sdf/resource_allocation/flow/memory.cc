@@ -34,6 +34,10 @@
  */
 
 #include "flow.h"
+#include "../../transform/model/overlay.h"
+#include <cstdio>
+#include <iomanip>
+#include <sstream>
 
 namespace SDF
 {
@@ -57,44 +61,85 @@ namespace SDF
     }
 
     /**
-     * computeStorageDistributions ()
-     * Compute trade-off space between storage space allocated to channels and
-     * maximal throughput of the application graph.
+     * storageDistributionCacheKey ()
+     * The function returns a hash of all graph properties which determine the
+     * storage-space / throughput trade-off space of the graph (i.e. the rates,
+     * initial tokens and end points of the channels and the execution times of
+     * the actors on their default processor).
      */
-    void SDF3Flow::computeStorageDistributions()
+    static CString storageDistributionCacheKey(TimedSDFgraph *g)
     {
-        StorageDistributionSet *distributionSet = NULL;
-        StorageDistribution *distr = NULL;
-        TimedSDFgraph *g;
+        unsigned long long values[5], key = 14695981039346656037ULL;
+        std::ostringstream str;
 
-        // Output current state of the flow
-        logInfo("Compute storage-space / throughput trade-offs.");
+        values[0] = g->nrActors();
+        values[1] = g->nrChannels();
+        for (uint i = 0; i < 2; i++)
+            key = (key ^ values[i]) * 1099511628211ULL;
 
-        // Assume absense of auto-concurrency (i.e. add self-edge to every actor)
-        g = getAppGraph()->clone();
         for (SDFactorsIter iter = g->actorsBegin(); iter != g->actorsEnd(); iter++)
         {
-            SDFactor *a = *iter;
-            g->createChannel(a, 1, a, 1, 1);
+            TimedSDFactor *a = (TimedSDFactor *)(*iter);
+
+            key = (key ^ a->getExecutionTime()) * 1099511628211ULL;
         }
 
-        // Set processor with lowest execution time as the default processor
-        for (SDFactorsIter iter = g->actorsBegin(); iter != g->actorsEnd(); iter++)
+        for (SDFchannelsIter iter = g->channelsBegin();
+             iter != g->channelsEnd(); iter++)
         {
-            TimedSDFactor *a = (TimedSDFactor *)(*iter);
-            TimedSDFactor::Processor *defaultProc = NULL;
+            SDFchannel *c = *iter;
+
+            values[0] = c->getSrcActor()->getId();
+            values[1] = c->getDstActor()->getId();
+            values[2] = c->getSrcPort()->getRate();
+            values[3] = c->getDstPort()->getRate();
+            values[4] = c->getInitialTokens();
+            for (uint i = 0; i < 5; i++)
+                key = (key ^ values[i]) * 1099511628211ULL;
+        }
 
-            for (TimedSDFactor::ProcessorsIter iterP = a->processorsBegin();
-                 iterP != a->processorsEnd(); iterP++)
-            {
-                TimedSDFactor::Processor *p = *iterP;
+        str << std::hex << std::setw(16) << std::setfill('0') << key;
 
-                if (defaultProc == NULL || defaultProc->execTime > p->execTime)
-                    defaultProc = p;
-            }
+        return str.str();
+    }
 
-            a->setDefaultProcessor(defaultProc->type);
-        }
+    /**
+     * modelStorageDistributionGraph ()
+     * The function applies the model on which the storage-space / throughput
+     * trade-off space is explored to the application graph: auto-concurrency
+     * is excluded (i.e. a self-edge is added to every actor) and the processor
+     * with the lowest execution time is the default processor of every actor.
+     * The search refers to the channels of this model by their id. The model
+     * is therefore applied (in the same order) whenever the search is
+     * continued, and undone when the overlay goes out of scope. Undoing the
+     * model brings back the cached artifacts of the application graph.
+     */
+    static void modelStorageDistributionGraph(TimedSDFgraphOverlay &overlay)
+    {
+        overlay.modelAutoConcurrency(1);
+        overlay.selectFastestProcessors();
+    }
+
+    /**
+     * computeStorageDistributions ()
+     * Compute trade-off space between storage space allocated to channels and
+     * maximal throughput of the application graph.
+     */
+    void SDF3Flow::computeStorageDistributions()
+    {
+#ifdef _SEARCH_THROUGHPUT_BUFFER_SPACE_AT_ONCE
+        StorageDistributionSet *distributionSet = NULL;
+        StorageDistribution *distr = NULL;
+#endif
+        TimedSDFgraphOverlay overlay(getAppGraph());
+        TimedSDFgraph *g = overlay.getGraph();
+
+        // Output current state of the flow
+        logInfo("Compute storage-space / throughput trade-offs.");
+
+        // Assume absense of auto-concurrency and select the processor with
+        // lowest execution time as the default processor
+        modelStorageDistributionGraph(overlay);
 
 #ifdef _SEARCH_THROUGHPUT_BUFFER_SPACE_AT_ONCE
         // Compute trade-off space
@@ -133,8 +178,28 @@ namespace SDF
 
 #else // _SEARCH_THROUGHPUT_BUFFER_SPACE_AT_ONCE
 
-        // Initialize the exploration algorithm
-        bufferAnalysisAlgo.initSearch(g);
+        // Initialize the exploration algorithm. The search is resumed when the
+        // cache contains an earlier search of the same graph.
+        storageDistributionCacheFile = "";
+        if (!getStorageDistributionCache().empty())
+        {
+            storageDistributionCacheFile = getStorageDistributionCache() + "/"
+                                           + storageDistributionCacheKey(g)
+                                           + ".dist";
+        }
+        ifstream cache(storageDistributionCacheFile.c_str());
+        if (cache.is_open() && bufferAnalysisAlgo.restoreSearch(g, cache))
+        {
+            logMsg("Resumed storage distribution search from '"
+                   + storageDistributionCacheFile + "'.");
+        }
+        else
+        {
+            bufferAnalysisAlgo.initSearch(g);
+        }
+
+        // The model is applied again whenever the search is continued
+        overlay.restore();
 
         // No storage distribution found and selected so far
         minStorageDistributions = NULL;
@@ -146,8 +211,7 @@ namespace SDF
         do
         {
             // Find next pareto point in the space
-            selectedStorageDistributionSet
-                = bufferAnalysisAlgo.findNextStorageDistributionSet();
+            selectedStorageDistributionSet = findNextStorageDistributionSet();
 
             // No new pareto point discovered?
             if (selectedStorageDistributionSet == NULL)
@@ -157,27 +221,6 @@ namespace SDF
                 return;
             }
 
-            // Update storage-space size to ignore added self-edges. These channels
-            // have space for 2 tokens. Note that only  distributions with a size
-            // larger then zero must be updated.
-            distributionSet = selectedStorageDistributionSet;
-            if (distributionSet->sz > 0)
-            {
-                // Update size of the set
-                distributionSet->sz = distributionSet->sz - 2 * g->nrActors();
-
-                // Update all distributions in the set
-                distr = distributionSet->distributions;
-                while (distr != NULL)
-                {
-                    // Update size of the distribution
-                    distr->sz = distributionSet->sz;
-
-                    // Next distribution
-                    distr = distr->next;
-                }
-            }
-
             // Is this the first point ever to be found?
             if (minStorageDistributions == NULL)
                 minStorageDistributions = selectedStorageDistributionSet;
@@ -192,6 +235,89 @@ namespace SDF
         setNextStateOfFlow(FlowSelectStorageDist);
     }
 
+    /**
+     * findNextStorageDistributionSet ()
+     * The function returns the pareto point which follows the selected storage
+     * distribution set in the storage-space / throughput trade-off space. Pareto
+     * points found by a search which is resumed from the cache are returned
+     * first. After that, the search is continued and its state is written to
+     * the cache. The function returns NULL when no new pareto point exists.
+     */
+    StorageDistributionSet *SDF3Flow::findNextStorageDistributionSet()
+    {
+        StorageDistributionSet *distributionSet, *lastExploredSet;
+        StorageDistribution *distr;
+        CString tmpFile;
+
+        // Pareto point found by a resumed search which is not used so far?
+        lastExploredSet = bufferAnalysisAlgo.getLastExploredStorageDistributionSet();
+        if (lastExploredSet != NULL
+            && selectedStorageDistributionSet != lastExploredSet)
+        {
+            if (selectedStorageDistributionSet == NULL)
+                distributionSet = bufferAnalysisAlgo.getStorageDistributionSets();
+            else
+                distributionSet = selectedStorageDistributionSet->next;
+
+            // A set with deadlocking distributions is no pareto point
+            if (distributionSet != NULL && distributionSet->thr == 0)
+                distributionSet = distributionSet->next;
+
+            // No pareto point left from the resumed search? Continue searching.
+            if (distributionSet != NULL)
+                return distributionSet;
+        }
+
+        // Find next pareto point in the space (on the model of the search)
+        TimedSDFgraphOverlay overlay(getAppGraph());
+        modelStorageDistributionGraph(overlay);
+        distributionSet = bufferAnalysisAlgo.findNextStorageDistributionSet();
+        if (distributionSet == NULL)
+            return NULL;
+
+        // Update storage-space size to ignore added self-edges. These channels
+        // have space for 2 tokens. Note that only  distributions with a size
+        // larger then zero must be updated.
+        if (distributionSet->sz > 0)
+        {
+            // Update size of the set
+            distributionSet->sz = distributionSet->sz - 2 * getAppGraph()->nrActors();
+
+            // Update all distributions in the set
+            distr = distributionSet->distributions;
+            while (distr != NULL)
+            {
+                // Update size of the distribution
+                distr->sz = distributionSet->sz;
+
+                // Next distribution
+                distr = distr->next;
+            }
+        }
+
+        // Store the state of the search in the cache (the file is replaced
+        // at once, so other flows never read a partially written search)
+        if (!storageDistributionCacheFile.empty())
+        {
+            tmpFile = storageDistributionCacheFile + ".tmp";
+            ofstream cache(tmpFile.c_str());
+
+            if (cache.is_open())
+            {
+                bufferAnalysisAlgo.storeSearch(cache);
+                cache.close();
+                std::rename(tmpFile.c_str(), storageDistributionCacheFile.c_str());
+            }
+            else
+            {
+                logWarning("Failed writing storage distribution cache '"
+                           + storageDistributionCacheFile + "'.");
+            }
+        }
+
+        return distributionSet;
+    }
+
     /**
      * selectStorageDistribution ()
      * Select storage distribution from the trade-off space.
@@ -260,8 +386,6 @@ namespace SDF
         while (selectedStorageDistribution == NULL);
 
 #else // _SEARCH_THROUGHPUT_BUFFER_SPACE_AT_ONCE
-        StorageDistributionSet *distributionSet = NULL;
-        StorageDistribution *distr = NULL;
 
         // Select next storage distribution within the set (advance to next set when
         // current set is exhausted)
@@ -280,8 +404,7 @@ namespace SDF
             // All storage distribution within current set (size) tried?
             if (selectedStorageDistribution == NULL)
             {
-                selectedStorageDistributionSet
-                    = bufferAnalysisAlgo.findNextStorageDistributionSet();
+                selectedStorageDistributionSet = findNextStorageDistributionSet();
 
                 // New set of larger storage distributions does not exist?
                 if (selectedStorageDistributionSet == NULL)
@@ -290,28 +413,6 @@ namespace SDF
                     setNextStateOfFlow(FlowFailed);
                     return;
                 }
-
-                // Update storage-space size to ignore added self-edges. These
-                // channels have space for 2 tokens. Note that only  distributions
-                // with a size larger then zero must be updated.
-                distributionSet = selectedStorageDistributionSet;
-                if (distributionSet->sz > 0)
-                {
-                    // Update size of the set
-                    distributionSet->sz = distributionSet->sz
-                                          - 2 * getAppGraph()->nrActors();
-
-                    // Update all distributions in the set
-                    distr = distributionSet->distributions;
-                    while (distr != NULL)
-                    {
-                        // Update size of the distribution
-                        distr->sz = distributionSet->sz;
-
-                        // Next distribution
-                        distr = distr->next;
-                    }
-                }
             }
         }
         while (selectedStorageDistribution == NULL);
@@ -69,6 +69,15 @@ namespace SDF
         type = t;
     }
 
+    /**
+     * CompBindings ()
+     * Copy constructor. The bindings of b are duplicated.
+     */
+    CompBindings::CompBindings(const CompBindings &b)
+    {
+        *this = b;
+    }
+
     /**
      * ~CompBindings ()
      * Destructor.
@@ -82,6 +91,36 @@ namespace SDF
         }
     }
 
+    /**
+     * operator= ()
+     * Assignment operator. Existing bindings are removed and the bindings of b
+     * are duplicated.
+     */
+    CompBindings &CompBindings::operator=(const CompBindings &b)
+    {
+        if (this == &b)
+            return *this;
+
+        for (ComponentBindingsIter iter = begin();
+             iter != end(); iter++)
+        {
+            delete(*iter);
+        }
+        bindings.clear();
+
+        for (ComponentBindingsCIter iter = b.begin();
+             iter != b.end(); iter++)
+        {
+            bindings.push_back(new ComponentBinding(**iter));
+        }
+
+        type = b.type;
+        maxVals = b.maxVals;
+        curVals = b.curVals;
+
+        return *this;
+    }
+
     /**
      * getMaxVal ()
      * The function returns the maximum value of a parameter.
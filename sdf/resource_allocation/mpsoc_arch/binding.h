@@ -91,10 +91,14 @@ namespace SDF
             // Constructor
             CompBindings(Type t = TypeSum);
             CompBindings(vector<double> &maxValues, Type t = TypeSum);
+            CompBindings(const CompBindings &b);
 
             // Destructor
             ~CompBindings();
 
+            // Assignment (copies all bindings)
+            CompBindings &operator=(const CompBindings &b);
+
             // Type of binding function (sum or max)
             Type getType() const
             {
@@ -0,0 +1,253 @@
+/*
+ *  TU Eindhoven
+ *  Eindhoven, The Netherlands
+ *
+ *  Name            :   checkpoint.cc
+ *
+ *  Author          :   agent (agent@local)
+ *
+ *  Date            :   October 19, 2026
+ *
+ *  Function        :   Checkpoint of the resource occupancy of a platform graph
+ *
+ *  History         :
+ *      19-10-26    :   Initial version.
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, 59 Temple Place - Suite 330, Boston, MA 02111-1307, USA.
+ *
+ * In other words, you are welcome to use, share and improve this program.
+ * You are forbidden to forbid anyone else to use, share and improve
+ * what you give them.   Happy coding!
+ */
+
+
+#include "checkpoint.h"
+namespace SDF
+{
+    /**
+     * PlatformGraphCheckpoint ()
+     * Constructor. The current resource occupancy of the platform graph g is
+     * stored in the checkpoint.
+     */
+    PlatformGraphCheckpoint::PlatformGraphCheckpoint(PlatformGraph *g)
+        :
+        platformGraph(g)
+    {
+        // Tiles
+        for (TilesIter iter = g->tilesBegin(); iter != g->tilesEnd(); iter++)
+        {
+            Tile *t = *iter;
+            NetworkInterface *ni = t->getNetworkInterface();
+            Processor *p = t->getProcessor();
+            Memory *m = t->getMemory();
+            TileOccupancy o;
+
+            o.occupiedTimeSlice = 0;
+            o.reservedTimeSlice = 0;
+            o.actorBindings = NULL;
+            o.memActorBindings = NULL;
+            o.memChannelBindings = NULL;
+            o.connectionBindings = NULL;
+
+            if (p != NULL)
+            {
+                o.occupiedTimeSlice = p->getOccupiedTimeSlice();
+                o.reservedTimeSlice = p->getReservedTimeSlice();
+                o.schedule = p->getSchedule();
+                o.actorBindings = copyBindings(p->getActorBindings());
+            }
+
+            if (m != NULL)
+            {
+                o.memActorBindings = copyBindings(m->getActorBindings());
+                o.memChannelBindings = copyBindings(m->getChannelBindings());
+            }
+
+            if (ni != NULL)
+                o.connectionBindings = copyBindings(ni->getBindings());
+
+            tiles.push_back(o);
+        }
+
+        // Connections
+        for (ConnectionsIter iter = g->connectionsBegin();
+             iter != g->connectionsEnd(); iter++)
+        {
+            Connection *c = *iter;
+
+            connections.push_back(copyBindings(c->getChannelBindings()));
+        }
+    }
+
+    /**
+     * ~PlatformGraphCheckpoint ()
+     * Destructor.
+     */
+    PlatformGraphCheckpoint::~PlatformGraphCheckpoint()
+    {
+        for (uint i = 0; i < tiles.size(); i++)
+        {
+            delete tiles[i].actorBindings;
+            delete tiles[i].memActorBindings;
+            delete tiles[i].memChannelBindings;
+            delete tiles[i].connectionBindings;
+        }
+
+        for (uint i = 0; i < connections.size(); i++)
+            delete connections[i];
+    }
+
+    /**
+     * copyBindings ()
+     * The function returns a copy of the bindings b, or NULL when b does
+     * not exist.
+     */
+    CompBindings *PlatformGraphCheckpoint::copyBindings(
+        const CompBindings *b) const
+    {
+        if (b == NULL)
+            return NULL;
+
+        return new CompBindings(*b);
+    }
+
+    /**
+     * restoreBindings ()
+     * The function replaces the bindings in b with the stored bindings s.
+     */
+    void PlatformGraphCheckpoint::restoreBindings(CompBindings *b,
+            const CompBindings *s) const
+    {
+        if (b == NULL || s == NULL)
+            return;
+
+        *b = *s;
+    }
+
+    /**
+     * restore ()
+     * The function restores the resource occupancy of the platform graph to
+     * the occupancy stored in the checkpoint.
+     */
+    void PlatformGraphCheckpoint::restore()
+    {
+        uint i;
+
+        // Tiles
+        i = 0;
+        for (TilesIter iter = platformGraph->tilesBegin();
+             iter != platformGraph->tilesEnd(); iter++, i++)
+        {
+            Tile *t = *iter;
+            NetworkInterface *ni = t->getNetworkInterface();
+            Processor *p = t->getProcessor();
+            Memory *m = t->getMemory();
+            TileOccupancy &o = tiles[i];
+
+            if (p != NULL)
+            {
+                p->releaseTimeSlice();
+                p->setOccupiedTimeSlice(o.occupiedTimeSlice);
+                p->reserveTimeSlice(o.reservedTimeSlice);
+                p->setSchedule(o.schedule);
+                restoreBindings(p->getActorBindings(), o.actorBindings);
+            }
+
+            if (m != NULL)
+            {
+                restoreBindings(m->getActorBindings(), o.memActorBindings);
+                restoreBindings(m->getChannelBindings(), o.memChannelBindings);
+            }
+
+            if (ni != NULL)
+                restoreBindings(ni->getBindings(), o.connectionBindings);
+        }
+
+        // Connections
+        i = 0;
+        for (ConnectionsIter iter = platformGraph->connectionsBegin();
+             iter != platformGraph->connectionsEnd(); iter++, i++)
+        {
+            Connection *c = *iter;
+
+            restoreBindings(c->getChannelBindings(), connections[i]);
+        }
+    }
+
+    /**
+     * claimBoundResourcesPlatformGraph ()
+     * The function removes all bindings of application components (actors and
+     * channels) from the platform graph. The resources used by these bindings
+     * remain unavailable. They are accounted in the same way as the resources
+     * marked as used through a system usage description (see
+     * setUsagePlatformGraph). The resulting platform graph can be used to bind
+     * the next application.
+     */
+    void claimBoundResourcesPlatformGraph(PlatformGraph *g)
+    {
+        double nrConnections, inBandwidth, outBandwidth;
+        StaticOrderSchedule emptySchedule;
+        CSize size, usedSize;
+
+        // Tiles
+        for (TilesIter iter = g->tilesBegin(); iter != g->tilesEnd(); iter++)
+        {
+            Tile *t = *iter;
+            NetworkInterface *ni = t->getNetworkInterface();
+            Processor *p = t->getProcessor();
+            Memory *m = t->getMemory();
+
+            // Processor
+            if (p != NULL)
+            {
+                p->setOccupiedTimeSlice(p->getTimewheelSize()
+                                        - p->availableTimewheelSize());
+                p->releaseTimeSlice();
+                p->setSchedule(emptySchedule);
+                *p->getActorBindings() = CompBindings();
+            }
+
+            // Memory
+            if (m != NULL && m->getActorBindings() != NULL)
+            {
+                size = m->getSize();
+                usedSize = size - m->availableMemorySize();
+                m->setSize(size);
+                m->reserveMemory(usedSize);
+            }
+
+            // Network interface
+            if (ni != NULL && ni->getBindings() != NULL)
+            {
+                nrConnections = ni->getBindings()->getCurVal(NetworkInterface::nrConn);
+                inBandwidth = ni->getBindings()->getCurVal(NetworkInterface::inBw);
+                outBandwidth = ni->getBindings()->getCurVal(NetworkInterface::outBw);
+                ni->setConnections(ni->getNrConnections(), ni->getInBandwidth(),
+                                   ni->getOutBandwidth());
+                ni->reserveConnection(NULL, (CSize) nrConnections, inBandwidth,
+                                      outBandwidth);
+            }
+        }
+
+        // Connections
+        for (ConnectionsIter iter = g->connectionsBegin();
+             iter != g->connectionsEnd(); iter++)
+        {
+            Connection *c = *iter;
+
+            if (c->getChannelBindings() != NULL)
+                *c->getChannelBindings() = CompBindings();
+        }
+    }
+}//namespace SDF
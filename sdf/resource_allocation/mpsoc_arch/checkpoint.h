@@ -0,0 +1,112 @@
+/*
+ *  TU Eindhoven
+ *  Eindhoven, The Netherlands
+ *
+ *  Name            :   checkpoint.h
+ *
+ *  Author          :   agent (agent@local)
+ *
+ *  Date            :   October 19, 2026
+ *
+ *  Function        :   Checkpoint of the resource occupancy of a platform graph
+ *
+ *  History         :
+ *      19-10-26    :   Initial version.
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, 59 Temple Place - Suite 330, Boston, MA 02111-1307, USA.
+ *
+ * In other words, you are welcome to use, share and improve this program.
+ * You are forbidden to forbid anyone else to use, share and improve
+ * what you give them.   Happy coding!
+ */
+
+
+#ifndef SDF_RESOURCE_ALLOCATION_MPSOC_CHECKPOINT_H_INCLUDED
+#define SDF_RESOURCE_ALLOCATION_MPSOC_CHECKPOINT_H_INCLUDED
+
+#include "graph.h"
+namespace SDF
+{
+    /**
+     * PlatformGraphCheckpoint
+     * Snapshot of all resource occupancies in a platform graph (time wheels,
+     * schedules, memories, network interfaces and connections). Restoring the
+     * checkpoint undoes all reservations and bindings made after the checkpoint
+     * was taken. The structure of the platform graph itself is not stored.
+     */
+    class PlatformGraphCheckpoint
+    {
+        public:
+
+            // Constructor
+            PlatformGraphCheckpoint(PlatformGraph *g);
+
+            // Destructor
+            ~PlatformGraphCheckpoint();
+
+            // A checkpoint owns copies of the bindings, so it cannot be copied
+            PlatformGraphCheckpoint(const PlatformGraphCheckpoint &) = delete;
+            PlatformGraphCheckpoint &operator=(const PlatformGraphCheckpoint &) = delete;
+
+            // Platform graph
+            PlatformGraph *getPlatformGraph() const
+            {
+                return platformGraph;
+            };
+
+            // Restore the resource occupancies of the checkpoint
+            void restore();
+
+        private:
+            /**
+             * TileOccupancy
+             * Resource occupancy of a single tile.
+             */
+            typedef struct _TileOccupancy
+            {
+                // Processor
+                CSize occupiedTimeSlice;
+                CSize reservedTimeSlice;
+                StaticOrderSchedule schedule;
+                CompBindings *actorBindings;
+
+                // Memory
+                CompBindings *memActorBindings;
+                CompBindings *memChannelBindings;
+
+                // Network interface
+                CompBindings *connectionBindings;
+            } TileOccupancy;
+
+            // Copy of a (possibly non-existing) set of bindings
+            CompBindings *copyBindings(const CompBindings *b) const;
+            void restoreBindings(CompBindings *b, const CompBindings *s) const;
+
+            // Platform graph
+            PlatformGraph *platformGraph;
+
+            // Occupancy of tiles and connections (indexed on their position)
+            vector<TileOccupancy> tiles;
+            vector<CompBindings *> connections;
+    };
+
+    /**
+     * claimBoundResourcesPlatformGraph ()
+     * Turn all resources bound to application components into resources which
+     * are occupied by other applications.
+     */
+    void claimBoundResourcesPlatformGraph(PlatformGraph *g);
+
+}//namespace SDF
+#endif
@@ -463,20 +463,8 @@ namespace SDF
         {
             CNode *scheduleNode = CGetChildNode(procNode, "schedule");
 
-            // Construct states of the schedule
-            for (CNode *stateNode = CGetChildNode(scheduleNode, "state");
-                 stateNode != NULL; stateNode = CNextNode(stateNode, "state"))
-            {
-                // Add the actor to the schedule
-                s.appendActor(g->getActor(CGetAttribute(stateNode, "actor")));
-
-                // Is this schedule entry the start of the periodic regime?
-                if (CHasAttribute(stateNode, "startOfPeriodicRegime")
-                    && CGetAttribute(stateNode, "startOfPeriodicRegime") == "true")
-                {
-                    s.setStartPeriodicSchedule(s.size() - 1);
-                }
-            }
+            // Construct states (and loops) of the schedule
+            s.constructFromXML(scheduleNode, g);
 
             // Link schedule to processor
             p->setSchedule(s);
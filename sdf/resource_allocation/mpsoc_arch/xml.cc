@@ -39,9 +39,11 @@ namespace SDF
     /**
      * createMappingNode ()
      * Create an XML node which describes the mapping of an application graph
-     * onto an platform graph.
+     * onto an platform graph. Repetitions in the static-order schedules are
+     * represented with loops when loopedSchedules is true.
      */
-    CNode *createMappingNode(PlatformGraph *g, SDFGraph *appGraph)
+    CNode *createMappingNode(PlatformGraph *g, SDFGraph *appGraph,
+                             const bool loopedSchedules)
     {
         CNode *mappingNode, *tileNode, *procNode, *memNode, *niNode;
         CNode *actorNode, *channelNode, *connectionNode;
@@ -89,7 +91,8 @@ namespace SDF
                 }
 
                 // Schedule
-                CAddNode(procNode, p->getSchedule().convertToXML());
+                CAddNode(procNode,
+                         p->getSchedule().convertToXML(loopedSchedules));
             }
 
             // Memory
@@ -210,7 +213,8 @@ namespace SDF
      * Output the binding of an SDFG to an platform graph in XML
      * format.
      */
-    void outputBindingAsXML(PlatformGraph *g, SDFGraph *appGraph, ostream &out)
+    void outputBindingAsXML(PlatformGraph *g, SDFGraph *appGraph, ostream &out,
+                            const bool loopedSchedules)
     {
         // SDF mapping node
         CNode *sdf3Node = CNewNode("sdf3");
@@ -223,7 +227,7 @@ namespace SDF
                       "http://www.es.ele.tue.nl/sdf3/xsd/sdf3-sdf.xsd");
         */
         // Mapping node
-        CAddNode(sdf3Node, createMappingNode(g, appGraph));
+        CAddNode(sdf3Node, createMappingNode(g, appGraph, loopedSchedules));
 
         // Create document and save it
         CDoc *doc = CNewDoc(sdf3Node);
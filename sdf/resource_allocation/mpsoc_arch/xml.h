@@ -42,9 +42,11 @@ namespace SDF
     /**
      * createMappingNode ()
      * Create an XML node which describes the mapping of an application graph
-     * onto an platform graph.
+     * onto an platform graph. Repetitions in the static-order schedules are
+     * represented with loops when loopedSchedules is true.
      */
-    CNode *createMappingNode(PlatformGraph *g, SDFGraph *appGraph);
+    CNode *createMappingNode(PlatformGraph *g, SDFGraph *appGraph,
+                             const bool loopedSchedules = false);
 
     /**
      * createPlatformGraphNode ()
@@ -63,7 +65,8 @@ namespace SDF
      * Output the binding of an SDFG to an platform graph in XML
      * format.
      */
-    void outputBindingAsXML(PlatformGraph *g, SDFGraph *appGraph, ostream &out);
+    void outputBindingAsXML(PlatformGraph *g, SDFGraph *appGraph, ostream &out,
+                            const bool loopedSchedules = false);
 
     /**
      * outputSystemUsageAsXML ()
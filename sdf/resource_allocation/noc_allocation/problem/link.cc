@@ -80,9 +80,7 @@ namespace SDF
         slotTableSize = slotTableSeq->getSlotTableSize();
 
         // Initialize slot reservations
-        slotReservations.resize(slotTableSize);
-        for (uint i = 0; i < slotTableSize; i++)
-            slotReservations[i] = false;
+        slotReservations.resize(slotTableSize, false);
 
         // Iterate over the slot table sequence
         for (SlotTablesIter iter = slotTableSeq->seqBegin();
@@ -92,8 +90,7 @@ namespace SDF
 
             reservationsInSlot = s.getUsedSlotsOfSchedule();
 
-            for (uint i = 0; i < slotTableSize; i++)
-                slotReservations[i] = slotReservations[i] || reservationsInSlot[i];
+            slotReservations |= reservationsInSlot;
         }
 
         return slotReservations;
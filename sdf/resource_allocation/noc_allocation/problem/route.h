@@ -118,5 +118,5 @@ namespace SDF
     typedef Routes::iterator        RoutesIter;
     typedef Routes::const_iterator  RoutesCIter;
 
-#endif
-}//namespace SDF
\ No newline at end of file
+}//namespace SDF
+#endif
\ No newline at end of file
@@ -35,8 +35,275 @@
 
 #include "slot.h"
 #include "schedulingentity.h"
+#include <bitset>
 namespace SDF
 {
+    /**
+     * SlotReservations ()
+     * Constructor.
+     */
+    SlotReservations::SlotReservations(const size_t sz, const bool v)
+        :
+        nrSlots(0)
+    {
+        for (uint i = 0; i < SLOT_RESERVATIONS_INLINE_WORDS; i++)
+            inlineWords[i] = 0;
+
+        resize(sz, v);
+    }
+
+    /**
+     * resize ()
+     * Change the number of slots. Existing slots keep their value, new slots
+     * are set to v.
+     */
+    void SlotReservations::resize(const size_t sz, const bool v)
+    {
+        size_t oldSize = nrSlots;
+        size_t n = (sz + 63) / 64;
+
+        // Move the words between the inline and heap storage when needed
+        if (n > SLOT_RESERVATIONS_INLINE_WORDS)
+        {
+            if (heapWords.empty())
+                heapWords.assign(inlineWords, inlineWords + nrWords());
+            heapWords.resize(n, 0);
+        }
+        else if (!heapWords.empty())
+        {
+            for (size_t i = 0; i < n; i++)
+                inlineWords[i] = heapWords[i];
+            for (size_t i = n; i < SLOT_RESERVATIONS_INLINE_WORDS; i++)
+                inlineWords[i] = 0;
+            heapWords.clear();
+        }
+
+        nrSlots = sz;
+        clearUnusedBits();
+
+        // Initialize the new slots
+        if (v)
+        {
+            for (size_t i = oldSize; i < sz; i++)
+                (*this)[i] = true;
+        }
+    }
+
+    /**
+     * assign ()
+     * Set all slots to v.
+     */
+    void SlotReservations::assign(const bool v)
+    {
+        Word *w = words();
+
+        for (size_t i = 0; i < nrWords(); i++)
+            w[i] = v ? ~Word(0) : Word(0);
+
+        clearUnusedBits();
+    }
+
+    /**
+     * flip ()
+     * Invert all slots.
+     */
+    void SlotReservations::flip()
+    {
+        Word *w = words();
+
+        for (size_t i = 0; i < nrWords(); i++)
+            w[i] = ~w[i];
+
+        clearUnusedBits();
+    }
+
+    /**
+     * operator&= ()
+     * Keep only the slots which are also set in s.
+     */
+    SlotReservations &SlotReservations::operator&=(const SlotReservations &s)
+    {
+        Word *w = words();
+        const Word *ws = s.words();
+
+        for (size_t i = 0; i < nrWords(); i++)
+            w[i] &= ws[i];
+
+        return *this;
+    }
+
+    /**
+     * operator|= ()
+     * Set all slots which are set in s.
+     */
+    SlotReservations &SlotReservations::operator|=(const SlotReservations &s)
+    {
+        Word *w = words();
+        const Word *ws = s.words();
+
+        for (size_t i = 0; i < nrWords(); i++)
+            w[i] |= ws[i];
+
+        return *this;
+    }
+
+    /**
+     * andNot ()
+     * Clear all slots which are set in s.
+     */
+    void SlotReservations::andNot(const SlotReservations &s)
+    {
+        Word *w = words();
+        const Word *ws = s.words();
+
+        for (size_t i = 0; i < nrWords(); i++)
+            w[i] &= ~ws[i];
+    }
+
+    /**
+     * extractWord ()
+     * The function returns the 64 slots starting at slot pos. Slots beyond the
+     * end of the slot table are zero.
+     */
+    SlotReservations::Word SlotReservations::extractWord(const size_t pos) const
+    {
+        const Word *w = words();
+        size_t idx = pos / 64;
+        size_t offset = pos % 64;
+        Word r;
+
+        if (idx >= nrWords())
+            return 0;
+
+        r = w[idx] >> offset;
+        if (offset != 0 && idx + 1 < nrWords())
+            r |= w[idx + 1] << (64 - offset);
+
+        return r;
+    }
+
+    /**
+     * andRotated ()
+     * Keep slot i only when slot (i + shift) mod size() is set in s. This
+     * combines the reservations of a link which is traversed 'shift' slots
+     * later than the first link of a route.
+     */
+    void SlotReservations::andRotated(const SlotReservations &s, const size_t shift)
+    {
+        Word *w = words();
+        size_t k;
+
+        if (nrSlots == 0)
+            return;
+
+        k = shift % nrSlots;
+        if (k == 0)
+        {
+            *this &= s;
+            return;
+        }
+
+        for (size_t i = 0; i < nrWords(); i++)
+        {
+            size_t pos = (i * 64 + k) % nrSlots;
+            size_t len = nrSlots - pos;
+            Word r;
+
+            // Slots from pos till the end of the table, followed by the
+            // slots from the start of the table
+            r = s.extractWord(pos);
+            if (len < 64)
+                r |= s.extractWord(0) << len;
+
+            w[i] &= r;
+        }
+
+        clearUnusedBits();
+    }
+
+    /**
+     * rotated ()
+     * The function returns the slot reservations r with r[i] equal to slot
+     * (i + shift) mod size() of this.
+     */
+    SlotReservations SlotReservations::rotated(const size_t shift) const
+    {
+        SlotReservations r(nrSlots, true);
+
+        r.andRotated(*this, shift);
+
+        return r;
+    }
+
+    /**
+     * intersects ()
+     * The function returns true when a slot is set in this and in s.
+     */
+    bool SlotReservations::intersects(const SlotReservations &s) const
+    {
+        const Word *w = words();
+        const Word *ws = s.words();
+
+        for (size_t i = 0; i < nrWords(); i++)
+        {
+            if ((w[i] & ws[i]) != 0)
+                return true;
+        }
+
+        return false;
+    }
+
+    /**
+     * any ()
+     * The function returns true when at least one slot is set.
+     */
+    bool SlotReservations::any() const
+    {
+        const Word *w = words();
+
+        for (size_t i = 0; i < nrWords(); i++)
+        {
+            if (w[i] != 0)
+                return true;
+        }
+
+        return false;
+    }
+
+    /**
+     * count ()
+     * The function returns the number of slots which are set.
+     */
+    size_t SlotReservations::count() const
+    {
+        const Word *w = words();
+        size_t n = 0;
+
+        for (size_t i = 0; i < nrWords(); i++)
+            n += std::bitset<64>(w[i]).count();
+
+        return n;
+    }
+
+    /**
+     * clearUnusedBits ()
+     * Clear the bits beyond the last slot.
+     */
+    void SlotReservations::clearUnusedBits()
+    {
+        Word *w = words();
+        size_t n = nrWords();
+
+        if (nrSlots % 64 != 0)
+            w[n - 1] &= (Word(1) << (nrSlots % 64)) - 1;
+
+        if (heapWords.empty())
+        {
+            for (size_t i = n; i < SLOT_RESERVATIONS_INLINE_WORDS; i++)
+                inlineWords[i] = 0;
+        }
+    }
+
     /**
      * SlotTable ()
      * Constructor.
@@ -45,13 +312,8 @@ namespace SDF
     {
         nrSlots = sz;
         nrFreeSlots = sz;
-        tableReservations.resize(sz);
-        tableEntities.resize(sz);
-        for (uint i = 0; i < sz; i++)
-        {
-            tableReservations[i] = false;
-            tableEntities[i] = NULL;
-        }
+        tableReservations.resize(sz, false);
+        tableEntities.resize(sz, NULL);
     }
 
     /**
@@ -69,19 +331,13 @@ namespace SDF
      */
     void SlotTable::setUsedSlots(SlotReservations &s)
     {
-        for (uint i = 0; i < getNrSlots(); i++)
-        {
-            // Slot i marked as used?
-            if (s[i] == true)
-            {
-                // Slot still free?
-                if (tableReservations[i] == false)
-                {
-                    tableReservations[i] = true;
-                    nrFreeSlots--;
-                }
-            }
-        }
+        SlotReservations newSlots = s;
+
+        // Slots marked as used which are still free
+        newSlots.andNot(tableReservations);
+
+        tableReservations |= newSlots;
+        nrFreeSlots -= (uint)newSlots.count();
     }
 
     /**
@@ -90,6 +346,20 @@ namespace SDF
      */
     void SlotTable::reserveSlots(NoCSchedulingEntity *e, SlotReservations &s)
     {
+        // No conflict with existing reservations?
+        if (!s.intersects(tableReservations))
+        {
+            for (uint i = 0; i < getNrSlots(); i++)
+            {
+                if (s[i])
+                    tableEntities[i] = e;
+            }
+
+            tableReservations |= s;
+            nrFreeSlots -= (uint)s.count();
+            return;
+        }
+
         for (uint i = 0; i < getNrSlots(); i++)
         {
             // Should slot i be reserved for e?
@@ -165,20 +435,18 @@ namespace SDF
     {
         SlotReservations s(getNrSlots(), false);
 
+        // Free slots are exactly the slots without a reservation
+        if (e == NULL)
+        {
+            s = tableReservations;
+            s.flip();
+            return s;
+        }
+
         for (uint i = 0; i < getNrSlots(); i++)
         {
             if (tableEntities[i] == e)
-            {
-                if (e == NULL)
-                {
-                    if (tableReservations[i] == false)
-                        s[i] = true;
-                }
-                else
-                {
-                    s[i] = true;
-                }
-            }
+                s[i] = true;
         }
 
         return s;
@@ -294,15 +562,8 @@ namespace SDF
     void SlotTableSeq::setUsedSlots(SlotReservations &s, TTime startTime,
                                     TTime endTime)
     {
-        bool slotUsed = false;
-
         // Check that at least one slot is used
-        for (uint i = 0; i < s.size() && !slotUsed; i++)
-        {
-            if (s[i])
-                slotUsed = true;
-        }
-        if (!slotUsed)
+        if (!s.any())
             return;
 
         // Iterate over the whole sequence
@@ -40,12 +40,109 @@
 #include "../../../../base/base.h"
 namespace SDF
 {
+    /**
+     * Number of words stored inside a SlotReservations object. Slot tables which
+     * need more words are stored on the heap.
+     */
+#define SLOT_RESERVATIONS_INLINE_WORDS  2
+
     /**
      * SlotReservations
      * A sequence of booleans which make wether a slot in the slot table is used or
-     * not-used.
+     * not-used. The booleans are packed into words, such that the reservations
+     * of complete slot tables can be combined with a few word operations. Bits
+     * beyond the size of the slot table are always zero.
      */
-    typedef vector<bool> SlotReservations;
+    class SlotReservations
+    {
+        public:
+            typedef unsigned long long Word;
+
+            // Reference to a single slot
+            class reference
+            {
+                public:
+                    reference(Word &w, const Word m) : word(w), mask(m) {};
+
+                    operator bool() const
+                    {
+                        return (word & mask) != 0;
+                    };
+                    reference &operator=(const bool v)
+                    {
+                        if (v)
+                            word |= mask;
+                        else
+                            word &= ~mask;
+                        return *this;
+                    };
+                    reference &operator=(const reference &r)
+                    {
+                        return *this = bool(r);
+                    };
+
+                private:
+                    Word &word;
+                    Word mask;
+            };
+
+            // Constructor
+            SlotReservations(const size_t sz = 0, const bool v = false);
+
+            // Destructor
+            ~SlotReservations() {};
+
+            // Size
+            size_t size() const
+            {
+                return nrSlots;
+            };
+            void resize(const size_t sz, const bool v = false);
+
+            // Access to a single slot
+            bool operator[](const size_t i) const
+            {
+                return (words()[i / 64] & (Word(1) << (i % 64))) != 0;
+            };
+            reference operator[](const size_t i)
+            {
+                return reference(words()[i / 64], Word(1) << (i % 64));
+            };
+
+            // Word-parallel operations
+            void assign(const bool v);
+            void flip();
+            SlotReservations &operator&=(const SlotReservations &s);
+            SlotReservations &operator|=(const SlotReservations &s);
+            void andNot(const SlotReservations &s);
+            void andRotated(const SlotReservations &s, const size_t shift);
+            SlotReservations rotated(const size_t shift) const;
+            bool intersects(const SlotReservations &s) const;
+            bool any() const;
+            size_t count() const;
+
+        private:
+            // Words
+            size_t nrWords() const
+            {
+                return (nrSlots + 63) / 64;
+            };
+            Word *words()
+            {
+                return heapWords.empty() ? inlineWords : &heapWords[0];
+            };
+            const Word *words() const
+            {
+                return heapWords.empty() ? inlineWords : &heapWords[0];
+            };
+            Word extractWord(const size_t pos) const;
+            void clearUnusedBits();
+
+            // Properties
+            size_t nrSlots;
+            Word inlineWords[SLOT_RESERVATIONS_INLINE_WORDS];
+            vector<Word> heapWords;
+    };
 
     // Forward class definition
     class NoCSchedulingEntity;
@@ -123,6 +220,10 @@ namespace SDF
             // Slot reservations
             SlotReservations getSlotReservations(NoCSchedulingEntity *e) const;
             SlotReservations getUsedSlotsOfSchedule() const;
+            const SlotReservations &getReservedSlots() const
+            {
+                return tableReservations;
+            };
 
         private:
             // Properties
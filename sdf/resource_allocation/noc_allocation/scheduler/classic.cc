@@ -323,10 +323,7 @@ namespace SDF
         findSlotsAllocatedForStream(e, s);
 
         // Count number of slots already allocated
-        nrSlotsAlloc = 0;
-        for (uint i = 0; i < slotTableSize; i++)
-            if (s[i])
-                nrSlotsAlloc++;
+        nrSlotsAlloc = s.count();
 
         // Find all packets already allocated in the slot table
         startPacket = true;
@@ -53,6 +53,12 @@ namespace SDF
             // Destructor
             ~ClassicNoCScheduler() {};
 
+            // Copy of the scheduler
+            NoCScheduler *clone() const
+            {
+                return new ClassicNoCScheduler(*this);
+            };
+
             // Schedule function
             bool solve()
             {
@@ -52,6 +52,12 @@ namespace SDF
             // Destructor
             ~GreedyNoCScheduler() {};
 
+            // Copy of the scheduler
+            NoCScheduler *clone() const
+            {
+                return new GreedyNoCScheduler(*this);
+            };
+
             // Schedule function
             bool solve()
             {
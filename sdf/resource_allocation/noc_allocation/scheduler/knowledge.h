@@ -66,6 +66,12 @@ namespace SDF
             // Destructor
             ~KnowledgeNoCScheduler() {};
 
+            // Copy of the scheduler
+            NoCScheduler *clone() const
+            {
+                return new KnowledgeNoCScheduler(*this);
+            };
+
             // Schedule function
             bool solve()
             {
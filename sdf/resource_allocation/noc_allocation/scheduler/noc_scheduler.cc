@@ -34,6 +34,9 @@
  */
 
 #include "noc_scheduler.h"
+#include <atomic>
+#include <thread>
+
 namespace SDF
 {
     /**
@@ -160,39 +163,309 @@ namespace SDF
      * schedule ()
      * The function tries to find a valid schedule for all scheduling problems.
      * On success, the function returns true. Otherwise, it returns false.
+     *
+     * Problems which are related through a switch (directly or through other
+     * problems) form a group. A problem prefers the slots used by the problems
+     * of its group which are solved before it. Groups are therefore
+     * independent and, when multiple threads are available, they are solved
+     * concurrently. The resulting schedule does not depend on the number of
+     * threads.
      */
     bool NoCScheduler::schedule(SetOfNoCScheduleProblems &problems)
     {
-        bool success = true;
+        NoCScheduleProblems sequence(problems.scheduleProblemsBegin(),
+                                     problems.scheduleProblemsEnd());
+        vector<NoCScheduleProblems> groups;
+        map<NoCScheduleProblem *, uint> groupOfProblem;
+        bool solved;
+
+        // Split the problems into independent groups
+        findIndependentProblems(problems, groups);
+        for (uint i = 0; i < groups.size(); i++)
+        {
+            for (NoCScheduleProblemsIter iter = groups[i].begin();
+                 iter != groups[i].end(); iter++)
+            {
+                groupOfProblem[*iter] = i;
+            }
+        }
+
+        // Solve the problems. Solving groups concurrently requires that the
+        // schedule of a problem does not depend on the order in which the
+        // groups are solved by the threads.
+        if (nrThreads > 1 && groups.size() > 1 && isDeterministic())
+        {
+            solved = scheduleInParallel(sequence, groups, groupOfProblem);
+        }
+        else
+        {
+            solved = true;
+            for (NoCScheduleProblemsIter iter = sequence.begin();
+                 solved && iter != sequence.end(); iter++)
+            {
+                solved = scheduleProblem(*iter, groups[groupOfProblem[*iter]]);
+            }
+        }
+
+        if (!solved)
+        {
+            for (NoCScheduleProblemsIter iter = sequence.begin();
+                 iter != sequence.end(); iter++)
+            {
+                NoCScheduleProblem *p = *iter;
+
+                if (!p->isProblemSolved())
+                {
+                    logError("Failed solving scheduling problem '"
+                             + p->getName() + "'");
+                    break;
+                }
+            }
+
+            return false;
+        }
+
+        return true;
+    }
+
+    /**
+     * scheduleSequence ()
+     * The function solves the scheduling problems in the order of the list. Each
+     * problem prefers the slots used by the problems solved before it. The
+     * function stops at the first problem for which no schedule is found.
+     */
+    bool NoCScheduler::scheduleSequence(NoCScheduleProblems &problems)
+    {
+        for (NoCScheduleProblemsIter iter = problems.begin();
+             iter != problems.end(); iter++)
+        {
+            // No chance of successfully solving the set of problems.
+            if (!scheduleProblem(*iter, problems))
+                return false;
+        }
+
+        return true;
+    }
+
+    /**
+     * scheduleProblem ()
+     * The function solves the scheduling problem p. The problem prefers the
+     * slots used by the solved problems in the list. The function returns
+     * true when a schedule is found.
+     */
+    bool NoCScheduler::scheduleProblem(NoCScheduleProblem *p,
+                                       NoCScheduleProblems &solvedProblems)
+    {
+        // Set scheduling problem p as the current problem
+        setSchedulingProblem(p);
+
+        // Mark prefered slots in all links
+        markPreferedSlotsOnLinks(solvedProblems);
+
+        // Try to solve the problem
+        p->setSolvedFlag(solve());
+
+        return p->isProblemSolved();
+    }
+
+    /**
+     * findIndependentProblems ()
+     * The function partitions the scheduling problems into groups. Two problems
+     * which are related through a switch constraint (directly or through other
+     * problems) end-up in the same group. Groups are ordered on their first
+     * problem and keep the order of the problems in the set.
+     */
+    void NoCScheduler::findIndependentProblems(SetOfNoCScheduleProblems &problems,
+            vector<NoCScheduleProblems> &groups)
+    {
+        map<NoCScheduleProblem *, uint> index;
+        vector<uint> group, parent;
+        uint nrGroups = 0;
 
-        // Iterate over the list of schedule problems and solve them one by one
+        // Every problem starts in its own set
+        for (NoCScheduleProblemsIter iter = problems.scheduleProblemsBegin();
+             iter != problems.scheduleProblemsEnd(); iter++)
+        {
+            index[*iter] = (uint) parent.size();
+            parent.push_back((uint) parent.size());
+        }
+
+        // Merge the sets of problems related through a switch
         for (NoCScheduleProblemsIter iter = problems.scheduleProblemsBegin();
              iter != problems.scheduleProblemsEnd(); iter++)
         {
             NoCScheduleProblem *p = *iter;
 
-            // Set scheduling problem p as the current problem
-            setSchedulingProblem(p);
+            for (NoCScheduleSwitchConstraintsIter iterS =
+                     p->scheduleSwitchConstraintsBegin();
+                 iterS != p->scheduleSwitchConstraintsEnd(); iterS++)
+            {
+                uint a = index[iterS->from];
+                uint b = index[iterS->to];
+
+                while (parent[a] != a)
+                    a = parent[a];
+                while (parent[b] != b)
+                    b = parent[b];
+
+                if (a < b)
+                    parent[b] = a;
+                else
+                    parent[a] = b;
+            }
+        }
+
+        // Collect the problems of every set
+        group.resize(parent.size());
+        for (NoCScheduleProblemsIter iter = problems.scheduleProblemsBegin();
+             iter != problems.scheduleProblemsEnd(); iter++)
+        {
+            uint i = index[*iter];
+            uint r = i;
+
+            while (parent[r] != r)
+                r = parent[r];
+
+            // The root of a set is its first problem
+            if (r == i)
+            {
+                group[i] = nrGroups++;
+                groups.push_back(NoCScheduleProblems());
+            }
+
+            groups[group[r]].push_back(*iter);
+        }
+    }
+
+    /**
+     * NoCParallelSchedule
+     * Work shared by the threads which solve groups of scheduling problems.
+     */
+    typedef struct _NoCParallelSchedule
+    {
+        // Groups of scheduling problems
+        vector<NoCScheduleProblems> *groups;
+
+        // Index of the next group to solve
+        std::atomic<uint> nextGroup;
+
+        // Position of every problem in the sequence and the first position
+        // at which a problem failed (problems after it are not solved)
+        map<NoCScheduleProblem *, uint> position;
+        std::atomic<uint> firstFailure;
+
+        // Error encountered while solving each group (empty when none)
+        vector<CString> errors;
+    } NoCParallelSchedule;
+
+    /**
+     * scheduleGroups ()
+     * Worker thread of the parallel scheduler. The groups are claimed one at a
+     * time. Within a group, a problem prefers the slots used by the problems
+     * solved before it in the same group. A group stops at its first failing
+     * problem and at the first problem which comes after a failing problem in
+     * the sequence.
+     */
+    void NoCScheduler::scheduleGroups(NoCParallelSchedule *work)
+    {
+        uint i;
+
+        while ((i = work->nextGroup.fetch_add(1)) < work->groups->size())
+        {
+            NoCScheduleProblems &group = (*work->groups)[i];
 
-            // Mark prefered slots in all links
-            markPreferedSlotsOnLinks(problems);
+            for (NoCScheduleProblemsIter iter = group.begin();
+                 iter != group.end(); iter++)
+            {
+                uint pos = work->position[*iter];
+                bool solved = false;
 
-            // Try to solve the problem
-            p->setSolvedFlag(solve());
+                if (pos > work->firstFailure)
+                    break;
+
+                try
+                {
+                    solved = scheduleProblem(*iter, group);
+                }
+                catch (CException &e)
+                {
+                    work->errors[i] = e.getMessage();
+                }
+
+                if (!solved)
+                {
+                    // Lower the first failing position in the sequence
+                    uint first = work->firstFailure;
+                    while (pos < first)
+                    {
+                        if (work->firstFailure.compare_exchange_weak(first, pos))
+                            break;
+                    }
+                    break;
+                }
+            }
+        }
+    }
+
+    /**
+     * scheduleInParallel ()
+     * The function solves the groups of scheduling problems concurrently. Each
+     * thread uses its own copy of the scheduler. Every problem before the
+     * first failing problem in the sequence is solved, so this problem (and
+     * its error) is the same as when the problems are solved one after the
+     * other.
+     */
+    bool NoCScheduler::scheduleInParallel(NoCScheduleProblems &sequence,
+            vector<NoCScheduleProblems> &groups,
+            map<NoCScheduleProblem *, uint> &groupOfProblem)
+    {
+        vector<NoCScheduler *> schedulers;
+        vector<std::thread> threads;
+        NoCParallelSchedule work;
+
+        // Solve the groups concurrently
+        work.groups = &groups;
+        work.nextGroup = 0;
+        work.errors.resize(groups.size());
+        work.firstFailure = UINT_MAX;
+        for (NoCScheduleProblemsIter iter = sequence.begin();
+             iter != sequence.end(); iter++)
+        {
+            uint pos = (uint) work.position.size();
+            work.position[*iter] = pos;
+        }
+
+        for (uint t = 1; t < nrThreads && t < groups.size(); t++)
+        {
+            schedulers.push_back(clone());
+            threads.push_back(std::thread(&NoCScheduler::scheduleGroups,
+                                          schedulers.back(), &work));
+        }
+        scheduleGroups(&work);
+
+        for (uint t = 0; t < threads.size(); t++)
+        {
+            threads[t].join();
+            delete schedulers[t];
+        }
+
+        // First problem in the sequence without a schedule
+        for (NoCScheduleProblemsIter iter = sequence.begin();
+             iter != sequence.end(); iter++)
+        {
+            NoCScheduleProblem *p = *iter;
 
-            // No schedule found?
             if (!p->isProblemSolved())
             {
-                logError("Failed solving scheduling problem '"
-                         + p->getName() + "'");
-                success = false;
+                // Solving the problem raised an error?
+                if (!work.errors[groupOfProblem[p]].empty())
+                    throw CException(work.errors[groupOfProblem[p]]);
 
-                // No chance of successfully solving the set of problems.
-                break;
+                return false;
             }
         }
 
-        return success;
+        return true;
     }
 
     /**
@@ -205,9 +478,22 @@ namespace SDF
      */
     void NoCScheduler::markPreferedSlotsOnLinks(SetOfNoCScheduleProblems &problems)
     {
-        // Iterate over the list of schedule problems and solve them one by one
-        for (NoCScheduleProblemsIter iter = problems.scheduleProblemsBegin();
-             iter != problems.scheduleProblemsEnd(); iter++)
+        NoCScheduleProblems sequence(problems.scheduleProblemsBegin(),
+                                     problems.scheduleProblemsEnd());
+
+        markPreferedSlotsOnLinks(sequence);
+    }
+
+    /**
+     * markPreferedSlotsOnLinks ()
+     * The function marks the slots used by the solved problems in the list as
+     * prefered slots in the interconnect graph of the current problem.
+     */
+    void NoCScheduler::markPreferedSlotsOnLinks(NoCScheduleProblems &problems)
+    {
+        // Iterate over the list of schedule problems
+        for (NoCScheduleProblemsIter iter = problems.begin();
+             iter != problems.end(); iter++)
         {
             NoCScheduleProblem *p = *iter;
 
@@ -439,7 +725,6 @@ namespace SDF
                                      const CSize maxDetour, bool exact, Routes &routes)
     {
         CSize minLength;
-        Route route;
 
         // Compute shortest path between the source and destination
         minLength = getLengthShortestPathBetweenNodes(src, dst);
@@ -447,53 +732,12 @@ namespace SDF
         // Create routes starting from source in all directions
         if (exact)
         {
-            findRoutes(src, dst, minLength + maxDetour, minLength + maxDetour,
-                       route, routes);
+            routeCache.getRoutes(src, dst, minLength + maxDetour,
+                                 minLength + maxDetour, routes);
         }
         else
         {
-            findRoutes(src, dst, minLength, minLength + maxDetour, route, routes);
-        }
-    }
-
-    /**
-     * findAllRoutes ()
-     * The function finds all routes between the given source and destination node
-     * within the specified minimum and maximum length.
-     */
-    void NoCScheduler::findRoutes(const Node *src, const Node *dst,
-                                  const CSize minLength, const CSize maxLength, Route &route,
-                                  Routes &routes)
-    {
-        Route r;
-        Link *l;
-
-        // End of recursion if the source node is the destination node.
-        if (src == dst)
-        {
-            if (route.length() >= minLength)
-                routes.push_back(route);
-            return;
-        }
-
-        // maximum length reached, but destination not reached
-        if (maxLength == 0) return;
-
-        // Continue with creating new routes along all outgoing links
-        for (LinksCIter iter = src->outgoingLinksBegin();
-             iter != src->outgoingLinksEnd(); iter++)
-        {
-            l = *iter;
-
-            // Is the destination node not seen on this route before?
-            if (!route.containsNode(l->getDstNode()))
-            {
-                // Create a new route with the link l added and continue till
-                // destination is reached
-                r = route;
-                r.appendLink(l);
-                findRoutes(l->getDstNode(), dst, minLength, maxLength - 1, r, routes);
-            }
+            routeCache.getRoutes(src, dst, minLength, minLength + maxDetour, routes);
         }
     }
 
@@ -504,48 +748,7 @@ namespace SDF
     CSize NoCScheduler::getLengthShortestPathBetweenNodes(const Node *src,
             const Node *dst)
     {
-        Nodes Q;
-        Node *n, *m;
-        Link *l;
-        NodesIter iterN;
-
-        // Initialization
-        v_uint d(getInterconnectGraph()->nrNodes(), UINT_MAX);
-        d[src->getId()] = 0;
-        Q = getInterconnectGraph()->getNodes();
-
-        while (!Q.empty())
-        {
-            // Extract min from Q
-            n = NULL;
-            for (NodesIter iter = Q.begin(); iter != Q.end(); iter++)
-            {
-                m = *iter;
-
-                if (n == NULL || d[m->getId()] < d[n->getId()])
-                {
-                    n = m;
-                    iterN = iter;
-                }
-            }
-            Q.erase(iterN);
-
-            // Reached destination?
-            if (n == dst)
-                return d[n->getId()];
-
-            for (LinksCIter iter = n->outgoingLinksBegin();
-                 iter != n->outgoingLinksEnd(); iter++)
-            {
-                l = *iter;
-                m = l->getDstNode();
-
-                if (d[m->getId()] > d[n->getId()] + 1)
-                    d[m->getId()] = d[n->getId()] + 1;
-            }
-        }
-
-        return UINT_MAX;
+        return routeCache.getDistance(src, dst);
     }
 
     /**
@@ -1099,12 +1302,9 @@ namespace SDF
             else
                 slotsLink = findFreeSlotsOnLink(l, startTime + linkNr, duration);
 
-            // Combine available slots of this link with route
-            for (uint i = 0; i < slotTableSize; i++)
-            {
-                slotsRoute[i] = slotsRoute[i]
-                                && slotsLink[(i + linkNr) % slotTableSize];
-            }
+            // Combine available slots of this link with route (slot i on the
+            // first link is slot i + linkNr on this link)
+            slotsRoute.andRotated(slotsLink, linkNr);
 
             // Next link
             linkNr++;
@@ -1125,7 +1325,6 @@ namespace SDF
         uint slotTableSize = getInterconnectGraph()->getSlotTableSize();
         SlotReservations slotsLink(slotTableSize, true);
         TTime slotTablePeriod, entStartTime, entEndTime;
-        SlotReservations slotsSlot;
         bool loopPeriod;
 
         // Compute time frame for scheduling entity
@@ -1150,11 +1349,8 @@ namespace SDF
             if (s.getEndTime() >= entStartTime
                 || (loopPeriod && s.getStartTime() <= entEndTime))
             {
-                slotsSlot = s.getSlotReservations(NULL);
-
-                // Combine slot reservations of this
-                for (uint i = 0; i < slotTableSize; i++)
-                    slotsLink[i] = slotsLink[i] && slotsSlot[i];
+                // Remove the slots reserved in this slot table
+                slotsLink.andNot(s.getReservedSlots());
             }
 
             // Slot table ends after end time?
@@ -1241,8 +1437,7 @@ namespace SDF
                 }
 
                 // Combine slot reservations of this
-                for (uint i = 0; i < slotTableSize; i++)
-                    slotsLink[i] = slotsLink[i] && slotsSlot[i];
+                slotsLink &= slotsSlot;
             }
 
             // Slot table ends after end time?
@@ -1271,7 +1466,6 @@ namespace SDF
 
         // NoC properties
         TTime slotTablePeriod = getInterconnectGraph()->getSlotTablePeriod();
-        CSize slotTableSize = getInterconnectGraph()->getSlotTableSize();
 
         // Start of communication
         e1startTime = e->getStartTime() % slotTablePeriod;
@@ -1305,9 +1499,7 @@ namespace SDF
         // Each link has the same severity if it conflicts (- the number of slots
         // allocated on all links is equal)
         slotReservations = e->getSlotReservations();
-        for (uint i = 0; i < slotTableSize; i++)
-            if (slotReservations[i] == true)
-                severityLink += 1;
+        severityLink = slotReservations.count();
 
         // Iterate over links in route of m.
         for (LinksCIter iterL2 = r->linksBegin(); iterL2 != r->linksEnd(); iterL2++)
@@ -1476,7 +1668,6 @@ namespace SDF
         uint linkNr = 0;
         CSize slotTableSize = getInterconnectGraph()->getSlotTableSize();
         SlotReservations slotReservations = e->getSlotReservations();
-        SlotReservations slotsLink((size_t) slotTableSize);
 
         if (e == NULL)
             return;
@@ -1488,8 +1679,8 @@ namespace SDF
             Link *l = *iter;
 
             // Construct cyclically shifted slot reservations for the link
-            for (uint i = 0; i < slotTableSize; i++)
-                slotsLink[(i + linkNr) % slotTableSize] = slotReservations[i];
+            SlotReservations slotsLink = slotReservations.rotated(
+                            (size_t)(slotTableSize - linkNr % slotTableSize));
 
             l->reserveSlots(e, slotsLink, linkNr);
 
@@ -1706,14 +1897,14 @@ namespace SDF
 
         // All slots assumed available
         slotsRoute.resize((size_t) slotTableSize);
-        for (uint i = 0; i < slotTableSize; i++)
-            slotsRoute[i] = true;
+        slotsRoute.assign(true);
 
         // Iterate over all links in the route
         linkSeqNr = 0;
         for (LinksIter iterL = r->linksBegin(); iterL != r->linksEnd(); iterL++)
         {
             l = *iterL;
+            SlotReservations slotsLink((size_t) slotTableSize, true);
 
             // Iterate over the complete time period to find slots not used
             // by any stream (i.e. free slots)
@@ -1722,16 +1913,12 @@ namespace SDF
             {
                 SlotTable &s = *iter;
 
-                for (uint i = 0; i < slotTableSize; i++)
-                {
-                    if (!s.isSlotFree(i))
-                    {
-                        slotsRoute[(size_t)((slotTableSize + i - linkSeqNr) % slotTableSize)]
-                            = false;
-                    }
-                }
+                slotsLink.andNot(s.getReservedSlots());
             }
 
+            // Slot i on the first link is slot i + linkSeqNr on this link
+            slotsRoute.andRotated(slotsLink, linkSeqNr);
+
             // Next link
             linkSeqNr++;
         }
@@ -38,20 +38,44 @@
 
 #include "../problem/problem.h"
 #include "../problem/packet.h"
+#include "route_cache.h"
 namespace SDF
 {
+    // Forward class definition
+    struct _NoCParallelSchedule;
+
     class NoCScheduler
     {
         public:
             // Constructor
-            NoCScheduler() {};
+            NoCScheduler() : nrThreads(1), curScheduleProblem(NULL) {};
 
             // Destructor
             virtual ~NoCScheduler() {};
 
+            // Copy of the scheduler (with identical settings)
+            virtual NoCScheduler *clone() const = 0;
+
+            // Does the schedule of a problem only depend on the problem and
+            // the slots used by the problems solved before it?
+            virtual bool isDeterministic() const
+            {
+                return true;
+            };
+
             // Schedule function
             bool schedule(SetOfNoCScheduleProblems &problems);
 
+            // Number of threads used to solve independent scheduling problems
+            uint getNrThreads() const
+            {
+                return nrThreads;
+            };
+            void setNrThreads(const uint n)
+            {
+                nrThreads = (n == 0 ? 1 : n);
+            };
+
             // Load scheduling entities for the scheduling problems from XML
             void assignSchedulingEntities(SetOfNoCScheduleProblems &problems,
                                           CNode *networkMappingNode);
@@ -65,11 +89,13 @@ namespace SDF
 
             // Mark prefered slots in the interconnect graph
             void markPreferedSlotsOnLinks(SetOfNoCScheduleProblems &problems);
+            void markPreferedSlotsOnLinks(NoCScheduleProblems &problems);
 
             // Scheduling problem that is being solved
             void setSchedulingProblem(NoCScheduleProblem *p)
             {
                 curScheduleProblem = p;
+                routeCache.bind(p->getInterconnectGraph());
             };
             NoCScheduleProblem *getSchedulingProblem() const
             {
@@ -118,8 +144,6 @@ namespace SDF
             // Routing
             void findAllRoutes(const Node *src, const Node *dst,
                                const CSize maxDetour, bool exact, Routes &routes);
-            void findRoutes(const Node *src, const Node *dst, const CSize minLength,
-                            const CSize maxLength, Route &route, Routes &routes);
             CSize getLengthShortestPathBetweenNodes(const Node *src, const Node *dst);
 
             // Slots
@@ -170,16 +194,33 @@ namespace SDF
             void reserveResources(NoCSchedulingEntity *e);
             void releaseResources(NoCSchedulingEntity *e);
 
-            // Routes (hash)
-            void createRoutesHash(const CSize maxDetour);
-            void destroyRoutesHash();
-
             // Print
             ostream &print(ostream &out) const;
 
         private:
+            // Solve a list of scheduling problems one after the other
+            bool scheduleSequence(NoCScheduleProblems &problems);
+            bool scheduleProblem(NoCScheduleProblem *p,
+                                 NoCScheduleProblems &solvedProblems);
+
+            // Split problems into groups not related through a switch
+            void findIndependentProblems(SetOfNoCScheduleProblems &problems,
+                                         vector<NoCScheduleProblems> &groups);
+
+            // Solve the groups of scheduling problems concurrently
+            bool scheduleInParallel(NoCScheduleProblems &sequence,
+                                    vector<NoCScheduleProblems> &groups,
+                                    map<NoCScheduleProblem *, uint> &groupOfProblem);
+            void scheduleGroups(struct _NoCParallelSchedule *work);
+
+            // Number of threads used to solve independent scheduling problems
+            uint nrThreads;
+
             // Scheduling problem that is being solved
             NoCScheduleProblem *curScheduleProblem;
+
+            // Routes and distances in the interconnect graph
+            NoCRouteCache routeCache;
     };
 }//namespace SDF
 #endif
@@ -54,6 +54,18 @@ namespace SDF
             // Destructor
             ~RandomNoCScheduler() {};
 
+            // Copy of the scheduler
+            NoCScheduler *clone() const
+            {
+                return new RandomNoCScheduler(*this);
+            };
+
+            // The schedule depends on the state of the random number generator
+            bool isDeterministic() const
+            {
+                return false;
+            };
+
             // Schedule function
             bool solve()
             {
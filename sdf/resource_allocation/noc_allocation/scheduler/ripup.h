@@ -53,6 +53,12 @@ namespace SDF
             // Destructor
             ~RipupNoCScheduler() {};
 
+            // Copy of the scheduler
+            NoCScheduler *clone() const
+            {
+                return new RipupNoCScheduler(*this);
+            };
+
             // Schedule function
             bool solve()
             {
@@ -0,0 +1,204 @@
+/*
+ *  TU Eindhoven
+ *  Eindhoven, The Netherlands
+ *
+ *  Name            :   route_cache.cc
+ *
+ *  Author          :   agent (agent@local)
+ *
+ *  Date            :   October 19, 2026
+ *
+ *  Function        :   Route cache for the NoC schedulers
+ *
+ *  History         :
+ *      19-10-26    :   Initial version.
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, 59 Temple Place - Suite 330, Boston, MA 02111-1307, USA.
+ *
+ * In other words, you are welcome to use, share and improve this program.
+ * You are forbidden to forbid anyone else to use, share and improve
+ * what you give them.   Happy coding!
+ */
+
+
+#include "route_cache.h"
+namespace SDF
+{
+    /**
+     * bind ()
+     * The function prepares the cache for the interconnect graph g. All routes
+     * and distances are discarded when the topology of g differs from the
+     * topology of the graph for which they were computed.
+     */
+    void NoCRouteCache::bind(InterconnectGraph *g)
+    {
+        vector< std::pair<CId, CId> > t;
+
+        // Links of g (ordered on their id)
+        links.resize(g->nrLinks());
+        for (LinksIter iter = g->linksBegin(); iter != g->linksEnd(); iter++)
+        {
+            Link *l = *iter;
+
+            links[l->getId()] = l;
+        }
+        for (uint i = 0; i < links.size(); i++)
+        {
+            t.push_back(std::pair<CId, CId>(links[i]->getSrcNode()->getId(),
+                                            links[i]->getDstNode()->getId()));
+        }
+
+        // Same topology?
+        if (nrNodes == g->nrNodes() && t == topology)
+            return;
+
+        // Discard all information on the old topology
+        routeSets.clear();
+        topology = t;
+        nrNodes = g->nrNodes();
+        onRoute.assign(nrNodes, false);
+
+        // Outgoing links of every node (in the order used by the nodes)
+        outgoingLinks.assign(nrNodes, vector<CId>());
+        for (NodesIter iter = g->nodesBegin(); iter != g->nodesEnd(); iter++)
+        {
+            Node *n = *iter;
+
+            for (LinksCIter iterL = n->outgoingLinksBegin();
+                 iterL != n->outgoingLinksEnd(); iterL++)
+            {
+                outgoingLinks[n->getId()].push_back((*iterL)->getId());
+            }
+        }
+
+        // Shortest path distances (breadth-first search from every node)
+        distance.assign(nrNodes * nrNodes, UINT_MAX);
+        for (CId src = 0; src < nrNodes; src++)
+        {
+            CSize *d = &distance[src * nrNodes];
+            vector<CId> queue;
+
+            d[src] = 0;
+            queue.push_back(src);
+            for (uint i = 0; i < queue.size(); i++)
+            {
+                CId n = queue[i];
+
+                for (vector<CId>::const_iterator iter = outgoingLinks[n].begin();
+                     iter != outgoingLinks[n].end(); iter++)
+                {
+                    CId m = topology[*iter].second;
+
+                    if (d[m] == UINT_MAX)
+                    {
+                        d[m] = d[n] + 1;
+                        queue.push_back(m);
+                    }
+                }
+            }
+        }
+    }
+
+    /**
+     * getRoutes ()
+     * The function appends all routes from src to dst with a length between
+     * minLength and maxLength (inclusive) to routes. The routes are enumerated
+     * depth-first along the outgoing links of the nodes. No route visits a node
+     * twice.
+     */
+    void NoCRouteCache::getRoutes(const Node *src, const Node *dst,
+                                  const CSize minLength, const CSize maxLength,
+                                  Routes &routes)
+    {
+        NoCRouteSetKey key(std::pair<CId, CId>(src->getId(), dst->getId()),
+                           std::pair<CSize, CSize>(minLength, maxLength));
+        map<NoCRouteSetKey, NoCRouteSet>::iterator iter = routeSets.find(key);
+
+        // Routes not yet enumerated?
+        if (iter == routeSets.end())
+        {
+            vector<CId> route;
+
+            iter = routeSets.insert(std::make_pair(key, NoCRouteSet())).first;
+            findRoutes(src->getId(), dst->getId(), minLength, maxLength, route,
+                       iter->second);
+        }
+
+        // Create the routes
+        const NoCRouteSet &s = iter->second;
+        uint start = 0;
+        for (uint i = 0; i < s.ends.size(); i++)
+        {
+            routes.push_back(Route());
+            Route &r = routes.back();
+
+            for (uint j = start; j < s.ends[i]; j++)
+                r.appendLink(links[s.links[j]]);
+
+            start = s.ends[i];
+        }
+    }
+
+    /**
+     * findRoutes ()
+     * The function enumerates all routes from src to dst which extend the given
+     * route with at most maxLength links, such that the total length is at least
+     * minLength. Branches which cannot reach dst within maxLength links are
+     * pruned using the shortest path distances.
+     */
+    void NoCRouteCache::findRoutes(const CId src, const CId dst,
+                                   const CSize minLength, const CSize maxLength,
+                                   vector<CId> &route, NoCRouteSet &routes)
+    {
+        // End of recursion if the source node is the destination node.
+        if (src == dst)
+        {
+            if (route.size() >= minLength)
+            {
+                routes.links.insert(routes.links.end(), route.begin(), route.end());
+                routes.ends.push_back((uint)routes.links.size());
+            }
+            return;
+        }
+
+        // Destination cannot be reached within the maximum length
+        if (distance[src * nrNodes + dst] > maxLength)
+            return;
+
+        // Continue with creating new routes along all outgoing links
+        for (vector<CId>::const_iterator iter = outgoingLinks[src].begin();
+             iter != outgoingLinks[src].end(); iter++)
+        {
+            CId l = *iter;
+            CId n = topology[l].second;
+            bool first = route.empty();
+
+            // Is the destination node not seen on this route before?
+            if (!onRoute[n])
+            {
+                if (first)
+                    onRoute[src] = true;
+                onRoute[n] = true;
+                route.push_back(l);
+
+                findRoutes(n, dst, minLength, maxLength - 1, route, routes);
+
+                route.pop_back();
+                onRoute[n] = false;
+                if (first)
+                    onRoute[src] = false;
+            }
+        }
+    }
+}//namespace SDF
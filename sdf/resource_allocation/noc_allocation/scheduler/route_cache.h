@@ -0,0 +1,110 @@
+/*
+ *  TU Eindhoven
+ *  Eindhoven, The Netherlands
+ *
+ *  Name            :   route_cache.h
+ *
+ *  Author          :   agent (agent@local)
+ *
+ *  Date            :   October 19, 2026
+ *
+ *  Function        :   Route cache for the NoC schedulers
+ *
+ *  History         :
+ *      19-10-26    :   Initial version.
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, 59 Temple Place - Suite 330, Boston, MA 02111-1307, USA.
+ *
+ * In other words, you are welcome to use, share and improve this program.
+ * You are forbidden to forbid anyone else to use, share and improve
+ * what you give them.   Happy coding!
+ */
+
+
+#ifndef SDF_RESOURCE_ALLOCATION_NOC_ALLOCATION_SCHEDULER_ROUTE_CACHE_H_INCLUDED
+#define SDF_RESOURCE_ALLOCATION_NOC_ALLOCATION_SCHEDULER_ROUTE_CACHE_H_INCLUDED
+
+#include "../problem/interconnect_graph.h"
+#include "../problem/route.h"
+namespace SDF
+{
+    /**
+     * NoCRouteCache
+     * Routes and shortest path distances between the nodes of an interconnect
+     * graph. The distances between all pairs of nodes are computed once. The
+     * routes between two nodes within a length interval are enumerated the
+     * first time they are requested. Routes are stored as sequences of link
+     * ids, so the cache remains valid for every interconnect graph with the same
+     * topology (e.g. the interconnect graphs of all scheduling problems derived
+     * from the same architecture).
+     */
+    class NoCRouteCache
+    {
+        public:
+            // Constructor
+            NoCRouteCache() : nrNodes(0) {};
+
+            // Destructor
+            ~NoCRouteCache() {};
+
+            // Use the cache for the interconnect graph g
+            void bind(InterconnectGraph *g);
+
+            // Length of the shortest path from src to dst (UINT_MAX if none)
+            CSize getDistance(const Node *src, const Node *dst) const
+            {
+                return distance[src->getId() * nrNodes + dst->getId()];
+            };
+
+            // All routes from src to dst with a length in [minLength, maxLength]
+            void getRoutes(const Node *src, const Node *dst, const CSize minLength,
+                           const CSize maxLength, Routes &routes);
+
+        private:
+            // Routes between two nodes (links of route i are stored in
+            // links[ends[i-1]...ends[i]-1])
+            typedef struct _NoCRouteSet
+            {
+                vector<CId> links;
+                vector<uint> ends;
+            } NoCRouteSet;
+
+            // Key of a route set (src, dst, minLength, maxLength)
+            typedef std::pair< std::pair<CId, CId>, std::pair<CSize, CSize> >
+            NoCRouteSetKey;
+
+            // Enumerate routes
+            void findRoutes(const CId src, const CId dst, const CSize minLength,
+                            const CSize maxLength, vector<CId> &route,
+                            NoCRouteSet &routes);
+
+            // Topology (source and destination node of every link)
+            uint nrNodes;
+            vector< std::pair<CId, CId> > topology;
+            vector< vector<CId> > outgoingLinks;
+
+            // Links of the interconnect graph currently bound to the cache
+            vector<Link *> links;
+
+            // Shortest path distances between all pairs of nodes
+            vector<CSize> distance;
+
+            // Routes
+            map<NoCRouteSetKey, NoCRouteSet> routeSets;
+
+            // Nodes on the route under construction
+            vector<bool> onRoute;
+    };
+}//namespace SDF
+#endif
@@ -0,0 +1,259 @@
+/*
+ *  TU Eindhoven
+ *  Eindhoven, The Netherlands
+ *
+ *  Name            :   looped_schedule.cc
+ *
+ *  Author          :   agent (agent@local)
+ *
+ *  Date            :   October 19, 2026
+ *
+ *  Function        :   Static-order schedule with nested loops
+ *
+ *  History         :
+ *      19-10-26    :   Initial version.
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, 59 Temple Place - Suite 330, Boston, MA 02111-1307, USA.
+ *
+ * In other words, you are welcome to use, share and improve this program.
+ * You are forbidden to forbid anyone else to use, share and improve
+ * what you give them.   Happy coding!
+ */
+
+#include "looped_schedule.h"
+namespace SDF
+{
+    /**
+     * createLoop ()
+     * The function returns the loop which fires actor a count times (body is
+     * empty) or which executes the body count times (a is NULL). A loop with
+     * a body of one loop is merged with this body loop. Identical loops are
+     * created only once.
+     */
+    uint LoopedStaticOrderSchedule::createLoop(SDFactor *a, uint count,
+            const vector<uint> &body)
+    {
+        map<vector<uint>, uint>::iterator iter;
+        vector<uint> key;
+        Loop l;
+
+        // Merge loop with a body of one loop (when the count does not overflow)
+        if (a == NULL && body.size() == 1
+            && loops[body[0]].count <= UINT_MAX / count)
+        {
+            Loop b = loops[body[0]];
+
+            return createLoop(b.actor, b.count * count, b.body);
+        }
+
+        // Loop exists already?
+        key.push_back(a == NULL ? 0 : a->getId() + 1);
+        key.push_back(count);
+        key.insert(key.end(), body.begin(), body.end());
+        iter = loopIndex.find(key);
+        if (iter != loopIndex.end())
+            return iter->second;
+
+        // Create the loop
+        l.actor = a;
+        l.count = count;
+        l.body = body;
+        if (a != NULL)
+        {
+            l.length = count;
+        }
+        else
+        {
+            l.length = 0;
+            for (uint i = 0; i < body.size(); i++)
+                l.length += loops[body[i]].length;
+            l.length *= count;
+        }
+        loops.push_back(l);
+        loopIndex[key] = loops.size() - 1;
+
+        return loops.size() - 1;
+    }
+
+    /**
+     * collapseRepetitions ()
+     * The function replaces every sequence of at least two consecutive
+     * repetitions of the same period loops in the sequence by a single loop.
+     * The function returns true when the sequence is changed.
+     */
+    bool LoopedStaticOrderSchedule::collapseRepetitions(vector<uint> &sequence,
+            const uint period)
+    {
+        vector<uint> result, body;
+        bool changed = false;
+        uint i = 0, k;
+
+        while (i < sequence.size())
+        {
+            // Number of consecutive repetitions of the body starting at i
+            k = 1;
+            while (i + (k + 1) * period <= sequence.size()
+                   && std::equal(sequence.begin() + i,
+                                 sequence.begin() + i + period,
+                                 sequence.begin() + i + k * period))
+            {
+                k++;
+            }
+
+            if (k > 1)
+            {
+                body.assign(sequence.begin() + i, sequence.begin() + i + period);
+                result.push_back(createLoop(NULL, k, body));
+                i += k * period;
+                changed = true;
+            }
+            else
+            {
+                result.push_back(sequence[i]);
+                i++;
+            }
+        }
+
+        if (changed)
+            sequence.swap(result);
+
+        return changed;
+    }
+
+    /**
+     * compressSequence ()
+     * The function converts the schedule entries in the range [first,last)
+     * into a sequence of loops. Consecutive firings of the same actor become
+     * one loop. Next, consecutive repetitions of a sequence of at most
+     * maxBodyLength loops are replaced by a loop till no repetitions are left.
+     * Each step takes linear time in the length of the sequence.
+     */
+    void LoopedStaticOrderSchedule::compressSequence(
+        StaticOrderScheduleEntryIter first, StaticOrderScheduleEntryIter last,
+        vector<uint> &sequence)
+    {
+        vector<uint> noBody;
+        bool changed;
+
+        // Consecutive firings of the same actor
+        while (first != last)
+        {
+            StaticOrderScheduleEntryIter run = first;
+            uint count = 0;
+
+            while (run != last && run->actor == first->actor && count < UINT_MAX)
+            {
+                run++;
+                count++;
+            }
+
+            sequence.push_back(createLoop(first->actor, count, noBody));
+            first = run;
+        }
+
+        // Repeated sequences of loops
+        do
+        {
+            changed = false;
+            for (uint p = 1; p <= maxBodyLength && 2 * p <= sequence.size(); p++)
+            {
+                if (collapseRepetitions(sequence, p))
+                    changed = true;
+            }
+        }
+        while (changed);
+    }
+
+    /**
+     * compress ()
+     * The function constructs the looped representation of the static-order
+     * schedule s.
+     */
+    void LoopedStaticOrderSchedule::compress(StaticOrderSchedule &s)
+    {
+        StaticOrderScheduleEntryIter startPeriodic;
+
+        loops.clear();
+        loopIndex.clear();
+        transient.clear();
+        periodic.clear();
+
+        // Schedule without periodic part is completely transient
+        if (s.getStartPeriodicSchedule() < s.size())
+            startPeriodic = s.begin() + s.getStartPeriodicSchedule();
+        else
+            startPeriodic = s.end();
+
+        compressSequence(s.begin(), startPeriodic, transient);
+        compressSequence(startPeriodic, s.end(), periodic);
+
+        transientLength = startPeriodic - s.begin();
+        periodicLength = s.end() - startPeriodic;
+    }
+
+    /**
+     * addLoopToXML ()
+     * The function adds an XML representation of the loop to the parent node.
+     * A loop which fires an actor is represented by a state node (with a count
+     * attribute when the actor is fired more than once). Other loops are
+     * represented by a loop node.
+     */
+    void LoopedStaticOrderSchedule::addLoopToXML(const uint loop,
+            CNode *parentNode, const bool startOfPeriodicRegime) const
+    {
+        const Loop &l = loops[loop];
+        CNode *node;
+
+        if (l.actor != NULL)
+        {
+            node = CAddNode(parentNode, "state");
+            CAddAttribute(node, "actor", l.actor->getName());
+            if (l.count > 1)
+                CAddAttribute(node, "count", CString(l.count));
+        }
+        else
+        {
+            node = CAddNode(parentNode, "loop");
+            CAddAttribute(node, "count", CString(l.count));
+        }
+
+        if (startOfPeriodicRegime)
+            CAddAttribute(node, "startOfPeriodicRegime", "true");
+
+        for (uint i = 0; i < l.body.size(); i++)
+            addLoopToXML(l.body[i], node, false);
+    }
+
+    /**
+     * convertToXML ()
+     * Convert the schedule to an XML representation. A schedule without
+     * repetitions is represented in the same way as a StaticOrderSchedule. The
+     * representation can be read with StaticOrderSchedule::constructFromXML.
+     */
+    CNode *LoopedStaticOrderSchedule::convertToXML() const
+    {
+        CNode *scheduleNode;
+
+        // Create a schedule node
+        scheduleNode = CNewNode("schedule");
+
+        for (uint i = 0; i < transient.size(); i++)
+            addLoopToXML(transient[i], scheduleNode, false);
+
+        for (uint i = 0; i < periodic.size(); i++)
+            addLoopToXML(periodic[i], scheduleNode, i == 0);
+
+        return scheduleNode;
+    }
+}//namespace SDF
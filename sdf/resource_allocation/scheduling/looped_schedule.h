@@ -0,0 +1,137 @@
+/*
+ *  TU Eindhoven
+ *  Eindhoven, The Netherlands
+ *
+ *  Name            :   looped_schedule.h
+ *
+ *  Author          :   agent (agent@local)
+ *
+ *  Date            :   October 19, 2026
+ *
+ *  Function        :   Static-order schedule with nested loops
+ *
+ *  History         :
+ *      19-10-26    :   Initial version.
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, 59 Temple Place - Suite 330, Boston, MA 02111-1307, USA.
+ *
+ * In other words, you are welcome to use, share and improve this program.
+ * You are forbidden to forbid anyone else to use, share and improve
+ * what you give them.   Happy coding!
+ */
+
+#ifndef SDF_RESOURCE_ALLOCATION_SCHEDULING_LOOPED_SCHEDULE_H_INCLUDED
+#define SDF_RESOURCE_ALLOCATION_SCHEDULING_LOOPED_SCHEDULE_H_INCLUDED
+
+#include "static_order_schedule.h"
+namespace SDF
+{
+    /**
+     * Looped static-order schedule
+     * A static-order schedule stored as a sequence of (nested) loops. A loop
+     * either fires one actor a number of times or it executes a sequence of
+     * loops (its body) a number of times. Identical loops are stored once. Like
+     * a StaticOrderSchedule, the schedule consists of a transient part, which
+     * is executed once, followed by a periodic part, which is repeated forever.
+     **/
+    class LoopedStaticOrderSchedule
+    {
+        public:
+            /**
+             * Loop
+             * A loop in the schedule.
+             */
+            typedef struct _Loop
+            {
+                // Actor fired by the loop (NULL when the loop has a body)
+                SDFactor *actor;
+
+                // Number of iterations
+                uint count;
+
+                // Loops executed in every iteration
+                vector<uint> body;
+
+                // Number of actor firings in the complete loop
+                unsigned long long length;
+            } Loop;
+
+            // Constructor
+            LoopedStaticOrderSchedule()
+            {
+                transientLength = 0;
+                periodicLength = 0;
+            };
+            LoopedStaticOrderSchedule(StaticOrderSchedule &s)
+            {
+                compress(s);
+            };
+
+            // Destructor
+            ~LoopedStaticOrderSchedule() {};
+
+            // Conversion from a flat static-order schedule
+            void compress(StaticOrderSchedule &s);
+
+            // Number of firings in the transient and periodic part
+            unsigned long long getTransientLength() const
+            {
+                return transientLength;
+            };
+            unsigned long long getPeriodicLength() const
+            {
+                return periodicLength;
+            };
+            bool empty() const
+            {
+                return transientLength + periodicLength == 0;
+            };
+
+            // Number of distinct loops
+            uint nrLoops() const
+            {
+                return loops.size();
+            };
+
+            // Convert the schedule to an XML representation
+            CNode *convertToXML() const;
+
+        private:
+            // Construction of loops
+            uint createLoop(SDFactor *a, uint count, const vector<uint> &body);
+            void compressSequence(StaticOrderScheduleEntryIter first,
+                                  StaticOrderScheduleEntryIter last,
+                                  vector<uint> &sequence);
+            bool collapseRepetitions(vector<uint> &sequence, const uint period);
+
+            // XML conversion of loops
+            void addLoopToXML(const uint loop, CNode *parentNode,
+                              const bool startOfPeriodicRegime) const;
+
+            // Largest loop body considered while compressing a sequence
+            static const uint maxBodyLength = 32;
+
+            // Distinct loops and index to find an existing loop
+            vector<Loop> loops;
+            map<vector<uint>, uint> loopIndex;
+
+            // Top-level sequences of loops
+            vector<uint> transient;
+            vector<uint> periodic;
+            unsigned long long transientLength;
+            unsigned long long periodicLength;
+    };
+
+}//namespace SDF
+#endif
@@ -38,6 +38,13 @@
 
 #include "static_order_schedule.h"
 
+/**
+ * Looped static-order schedule
+ * Compact representation of a static-order schedule in which repeated
+ * firings and repeated sequences of firings are stored as (nested) loops.
+ */
+#include "looped_schedule.h"
+
 /**
  * List scheduler
  * Constructs a set of static-order schedules for the processors in the
@@ -34,6 +34,7 @@
  */
 
 #include "static_order_schedule.h"
+#include "looped_schedule.h"
 namespace SDF
 {
 
@@ -45,13 +46,15 @@ namespace SDF
      * contains the smallest repeated part in the periodic phase of the schedule.
      * From the transient phase, all complete repetitions of the periodic phase are
      * removed. The schedule entries in the minimized schedule are assigned new
-     * id's once the minimization is completed.
+     * id's once the minimization is completed. The minimization takes linear
+     * time in the length of the schedule.
      */
     void StaticOrderSchedule::minimize()
     {
-        uint periodicStart, periodicEnd, transientEnd, posPattern, posSchedule;
+        uint periodicStart, periodicEnd, periodicLength, period, transientEnd;
+        uint posPattern, posSchedule;
         StaticOrderSchedule newSchedule;
-        bool startOfPattern = true;
+        vector<uint> prefix;
 
         // Empty schedule?
         if (empty())
@@ -59,55 +62,38 @@ namespace SDF
 
         // Start of the periodic schedule
         periodicStart = getStartPeriodicSchedule();
-        ASSERT(periodicStart != UINT_MAX, "No periodic regime in the schedule");
+        ASSERT(periodicStart < size(), "No periodic regime in the schedule");
 
-        // Find smallest repeated part in the periodic schedule
-        periodicEnd = periodicStart;
-        posPattern = periodicStart;
-        posSchedule = next(periodicEnd);
-
-        while (posSchedule != periodicStart)
+        // Find smallest repeated part in the periodic schedule. The length of
+        // the longest proper prefix of the periodic schedule which is also a
+        // suffix of it (computed with the prefix function of Knuth-Morris-Pratt)
+        // gives the smallest period. The periodic schedule is a repetition of
+        // this period when the period divides its length.
+        periodicLength = size() - periodicStart;
+        prefix.resize(periodicLength);
+        prefix[0] = 0;
+        for (uint i = 1; i < periodicLength; i++)
         {
-            // Examining position in schedule (so no longer at start of pattern)
-            startOfPattern = false;
+            uint k = prefix[i - 1];
 
-            // Actor at posSchedule not equal to actor at posPattern?
-            if (getScheduleEntry(posSchedule)->actor->getId()
-                != getScheduleEntry(posPattern)->actor->getId())
+            while (k > 0 && getScheduleEntry(periodicStart + i)->actor->getId()
+                   != getScheduleEntry(periodicStart + k)->actor->getId())
             {
-                // Add schedule part up-to and including posSchedule to the
-                // pattern and restart the search starting from the next
-                // position in the schedule
-                periodicEnd = posSchedule;
-                posPattern = periodicStart;
+                k = prefix[k - 1];
             }
-            else
+
+            if (getScheduleEntry(periodicStart + i)->actor->getId()
+                == getScheduleEntry(periodicStart + k)->actor->getId())
             {
-                // Actor in schedule matches with actor in pattern, move one
-                // position forward in pattern and in schedule (loop on pattern
-                // if needed).
-                posPattern = next(posPattern);
-                if (posPattern == next(periodicEnd))
-                {
-                    posPattern = periodicStart;
-                    startOfPattern = true;
-                }
+                k++;
             }
 
-            // Last element reached?
-            if (isLast(posSchedule))
-                break;
-
-            // Next
-            posSchedule = next(posSchedule);
-        }
-
-        // Is the exact end of the repeated part of the schedule not reached?
-        if (!startOfPattern)
-        {
-            // No exact repetition of pattern
-            periodicEnd = posSchedule;
+            prefix[i] = k;
         }
+        period = periodicLength - prefix[periodicLength - 1];
+        if (periodicLength % period != 0)
+            period = periodicLength;
+        periodicEnd = periodicStart + period - 1;
 
         // Remove actor from non-repeated part of the schedule
         // An part can be removed if (starting from the back), the
@@ -194,12 +180,18 @@ namespace SDF
 
     /**
      * convertToXML ()
-     * Convert the schedule to an XML representation.
+     * Convert the schedule to an XML representation. When looped is true,
+     * repetitions in the schedule are represented with loop nodes (see
+     * LoopedStaticOrderSchedule).
      */
-    CNode *StaticOrderSchedule::convertToXML()
+    CNode *StaticOrderSchedule::convertToXML(const bool looped)
     {
         CNode *scheduleNode, *stateNode;
 
+        // Represent repetitions with loops?
+        if (looped)
+            return LoopedStaticOrderSchedule(*this).convertToXML();
+
         // Create a schedule node
         scheduleNode = CNewNode("schedule");
 
@@ -224,4 +216,63 @@ namespace SDF
         return scheduleNode;
     }
 
+    /**
+     * appendFromXML ()
+     * The function appends the states and loops inside the node to the
+     * schedule. A state fires its actor once, or count times when it has a
+     * count attribute. A loop executes its states and loops count times.
+     */
+    void StaticOrderSchedule::appendFromXML(CNode *node, SDFGraph *g)
+    {
+        for (CNode *n = CGetChildNode(node); n != NULL; n = CNextNode(n))
+        {
+            uint count = 1;
+
+            if (!CIsNode(n, "state") && !CIsNode(n, "loop"))
+                continue;
+
+            if (CHasAttribute(n, "count"))
+                count = CGetAttribute(n, "count");
+
+            // Is this schedule entry the start of the periodic regime? (A
+            // node inside a loop is visited once for every iteration; only
+            // its first firing starts the periodic regime.)
+            if (CHasAttribute(n, "startOfPeriodicRegime")
+                && CGetAttribute(n, "startOfPeriodicRegime") == "true"
+                && getStartPeriodicSchedule() == UINT_MAX)
+            {
+                setStartPeriodicSchedule(size());
+            }
+
+            if (CIsNode(n, "state"))
+            {
+                SDFactor *a = g->getActor(CGetAttribute(n, "actor"));
+
+                if (a == NULL)
+                    throw CException("[ERROR] actor does not exist.");
+
+                for (uint i = 0; i < count; i++)
+                    appendActor(a);
+            }
+            else
+            {
+                for (uint i = 0; i < count; i++)
+                    appendFromXML(n, g);
+            }
+        }
+    }
+
+    /**
+     * constructFromXML ()
+     * The function constructs the schedule from its XML representation (as
+     * created by convertToXML).
+     */
+    void StaticOrderSchedule::constructFromXML(CNode *scheduleNode, SDFGraph *g)
+    {
+        clear();
+        setStartPeriodicSchedule(UINT_MAX);
+
+        appendFromXML(scheduleNode, g);
+    }
+
 }//namespace SDF
@@ -158,10 +158,17 @@ namespace SDF
             // Change the associated actors in the schedule
             void changeActorAssociations(SDFGraph *newGraph);
 
-            // Convert the schedule to an XML representation
-            CNode *convertToXML();
+            // Convert the schedule to an XML representation (with loops when
+            // looped is true)
+            CNode *convertToXML(const bool looped = false);
+
+            // Construct the schedule from an XML representation
+            void constructFromXML(CNode *scheduleNode, SDFGraph *g);
 
         private:
+            // Append the states and loops inside the node to the schedule
+            void appendFromXML(CNode *node, SDFGraph *g);
+
             uint startPeriodicSchedule;
     };
 
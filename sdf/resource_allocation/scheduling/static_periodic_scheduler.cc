@@ -97,6 +97,31 @@ namespace SDF
         glbClk = 0;
     }
 
+    /**
+     * pack ()
+     * The function stores the words which identify the state in words. Two
+     * states are equal when their words are equal.
+     */
+    void SDFstateSpaceStaticPeriodicScheduler::TransitionSystem::State::pack(
+        vector<unsigned long long> &words) const
+    {
+        words.clear();
+        words.push_back(glbClk);
+
+        for (uint i = 0; i < ch.size(); i++)
+            words.push_back(ch[i]);
+
+        for (uint i = 0; i < actClk.size(); i++)
+        {
+            words.push_back(actClk[i].size());
+            for (list<SDFtime>::const_iterator iter = actClk[i].begin();
+                 iter != actClk[i].end(); iter++)
+            {
+                words.push_back(*iter);
+            }
+        }
+    }
+
     /**
      * operator== ()
      * The function compares to states and returns true if they are equal.
@@ -134,21 +159,13 @@ namespace SDF
     void SDFstateSpaceStaticPeriodicScheduler::TransitionSystem::initOutputActor()
     {
         RepetitionVector repVec;
-        int min = INT_MAX;
-        SDFactor *a = NULL;
+        SDFactor *a;
 
         // Compute repetition vector
         repVec = computeRepetitionVector(g);
 
         // Select actor with lowest entry in repetition vector as output actor
-        for (SDFactorsIter iter = g->actorsBegin(); iter != g->actorsEnd(); iter++)
-        {
-            if (repVec[(*iter)->getId()] < min)
-            {
-                a = *iter;
-                min = repVec[a->getId()];
-            }
-        }
+        a = selectOutputActor(g);
 
         // Set output actor and its repetition vector count
         outputActor = a->getId();
@@ -718,7 +735,7 @@ namespace SDF
      * The throughput is returned.
      */
     CFraction SDFstateSpaceStaticPeriodicScheduler::TransitionSystem
-    ::execSDFgraphSelfTimed()
+    ::execSDFgraphSelfTimed(const bool detectCycle)
     {
         StatesIter recurrentState;
         SDFtime clkStep;
@@ -726,6 +743,7 @@ namespace SDF
 
         // Clear the list of stored states
         clearStoredStates();
+        cycleDetector.clear();
 
         // Create initial state
         currentState.init(g->nrActors(), g->nrChannels());
@@ -763,8 +781,25 @@ namespace SDF
 #ifdef _PRINT_STATESPACE
                             printState(currentState, cout);
 #endif
+                            // Compare state with the tortoise of the cycle
+                            // detection
+                            if (detectCycle)
+                            {
+                                currentState.pack(packedState);
+                                if (cycleDetector.visit(packedState,
+                                                        currentState.glbClk))
+                                {
+#ifdef _PRINT_STATESPACE
+                                    cout << "### end statespace exploration";
+                                    cout << endl;
+#endif
+                                    return CFraction(
+                                        (int)cycleDetector.getCycleLength(),
+                                        (int)cycleDetector.getCycleTime());
+                                }
+                            }
                             // Add state to hash of visited states
-                            if (!storeState(currentState, recurrentState))
+                            else if (!storeState(currentState, recurrentState))
                             {
 #ifdef _PRINT_STATESPACE
                                 cout << "### end statespace exploration" << endl;
@@ -830,7 +865,7 @@ namespace SDF
         TransitionSystem transitionSystem(g);
 
         // Compute the maximal throughput of the graph
-        thr = transitionSystem.execSDFgraphSelfTimed();
+        thr = transitionSystem.execSDFgraphSelfTimed(cycleDetection);
 
         // Reduce throughput fraction to irreducable form
         thr = thr.lowestTerm();
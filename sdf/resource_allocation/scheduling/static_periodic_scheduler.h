@@ -38,6 +38,7 @@
 #define SDF_RESOURCE_ALLOCATION_SCHEDULING_STATIC_PERIODIC_SCHEDULER_H_INCLUDED
 
 #include "../../base/timed/graph.h"
+#include "../../analysis/throughput/cycle_detector.h"
 namespace SDF
 {
 
@@ -51,7 +52,10 @@ namespace SDF
     {
         public:
             // Constructor
-            SDFstateSpaceStaticPeriodicScheduler() {};
+            SDFstateSpaceStaticPeriodicScheduler()
+            {
+                cycleDetection = false;
+            };
 
             // Destructor
             ~SDFstateSpaceStaticPeriodicScheduler() {};
@@ -59,6 +63,13 @@ namespace SDF
             // Schedule the graph
             void schedule(TimedSDFgraph *g);
 
+            // Find the recurrent state of the self-timed execution with
+            // Brent's algorithm instead of storing all visited states
+            void setCycleDetection(const bool flag)
+            {
+                cycleDetection = flag;
+            };
+
         private:
 
             /***************************************************************************
@@ -99,6 +110,9 @@ namespace SDF
                             // Output state
                             void print(ostream &out);
 
+                            // Words which identify the state
+                            void pack(vector<unsigned long long> &words) const;
+
                             // State information
                             vector< list<SDFtime> > actClk;
                             vector< TBufSize > ch;
@@ -120,7 +134,8 @@ namespace SDF
                     ~TransitionSystem() {};
 
                     // Execute the SDFG
-                    CFraction execSDFgraphSelfTimed();
+                    CFraction execSDFgraphSelfTimed(
+                        const bool detectCycle = false);
                     CFraction execSDFgraphComputeSchedule(
                         vector< vector<long long int> > &startTime,
                         const long long int period,
@@ -162,7 +177,14 @@ namespace SDF
 
                     // List of visited states that are stored
                     States storedStates;
+
+                    // Recurrent-state detection without stored states
+                    SDFstateSpaceCycleDetector cycleDetector;
+                    vector<unsigned long long> packedState;
             };
+
+            // Recurrent-state detection with Brent's algorithm
+            bool cycleDetection;
     };
 
 }//namespace SDF
@@ -34,8 +34,7 @@
  */
 
 #include "binding.h"
-#include "../../transform/model/autoconc.h"
-#include "../../transform/model/buffersize.h"
+#include "../../transform/model/overlay.h"
 #include "../../output/xml/xml.h"
 namespace SDF
 {
@@ -50,11 +49,11 @@ namespace SDF
     double Binding::analyzeThroughputApplication()
     {
         SDFstateSpaceThroughputAnalysis thrAnalysisAlgo;
-        TimedSDFgraph *g, *gr;
-        double thrGraph;
+        TimedSDFgraphOverlay overlay(appGraph);
+        TimedSDFgraph *g = overlay.getGraph();
 
         // Model absense of auto-concurrency in SDFG
-        g = (TimedSDFgraph *)modelAutoConcurrencyInSDFgraph(appGraph, 1);
+        overlay.modelAutoConcurrency(1);
 
         // Set buffer size of each channel to max(mem, src+dst)
         for (SDFchannelsIter iter = g->channelsBegin();
@@ -66,41 +65,18 @@ namespace SDF
             if (sz.mem < sz.src + sz.dst)
             {
                 sz.sz = sz.src + sz.dst;
-                c->setBufferSize(sz);
+                overlay.setBufferSize(c, sz);
             }
         }
 
         // Model buffer constraints in SDFG
-        gr = modelBufferSizeInSDFgraph(g);
+        overlay.modelBufferSize();
 
         // Select fastest processor for each actor as the default processor
-        for (SDFactorsIter iter = gr->actorsBegin();
-             iter != gr->actorsEnd(); iter++)
-        {
-            TimedSDFactor *a = (TimedSDFactor *)*iter;
-            TimedSDFactor::Processor *proc = NULL;
-
-            for (TimedSDFactor::ProcessorsIter iterP = a->processorsBegin();
-                 iterP != a->processorsEnd(); iterP++)
-            {
-                TimedSDFactor::Processor *p = *iterP;
-
-                if (proc == NULL || proc->execTime > p->execTime)
-                    proc = p;
-            }
+        overlay.selectFastestProcessors();
 
-            if (proc != NULL)
-                a->setDefaultProcessor(proc->type);
-        }
-
-        // Compute throughput of the SDFG
-        thrGraph = thrAnalysisAlgo.analyze(gr);
-
-        // Cleanup
-        delete g;
-        delete gr;
-
-        return thrGraph;
+        // Compute throughput of the SDFG (the overlay is undone on return)
+        return thrAnalysisAlgo.analyze(g);
     }
 
     /**
@@ -37,6 +37,7 @@
 #define SDF_RESOURCE_ALLOCATION_TILE_ALLOCATION_BINDING_H_INCLUDED
 
 #include "../mpsoc_arch/graph.h"
+#include "../mpsoc_arch/checkpoint.h"
 #include "../../analysis/analysis.h"
 namespace SDF
 {
@@ -57,10 +58,14 @@ namespace SDF
                 archGraph = NULL;
                 appGraph = NULL;
                 flowType = type;
+                checkpoint = NULL;
             };
 
             // Destructor
-            virtual ~Binding() {};
+            virtual ~Binding()
+            {
+                delete checkpoint;
+            };
 
             // Application graph
             TimedSDFgraph *getAppGraph()
@@ -77,6 +82,7 @@ namespace SDF
             void setArchGraph(PlatformGraph *g)
             {
                 archGraph = g;
+                discardCheckpoint();
             };
 
             // Flow
@@ -104,6 +110,18 @@ namespace SDF
             // Static order schedule
             void minimizeStaticOrderSchedules(PlatformGraph *archGraph);
 
+            // Resource occupancy of the architecture before the binding started
+            void createCheckpoint()
+            {
+                delete checkpoint;
+                checkpoint = new PlatformGraphCheckpoint(archGraph);
+            };
+            void discardCheckpoint()
+            {
+                delete checkpoint;
+                checkpoint = NULL;
+            };
+
         protected:
             // Architecture graph
             PlatformGraph *archGraph;
@@ -113,6 +131,9 @@ namespace SDF
 
             // Flow
             SDFflowType flowType;
+
+            // Resource occupancy of the architecture before the binding started
+            PlatformGraphCheckpoint *checkpoint;
     };
 
 }//namespace SDF
@@ -88,6 +88,9 @@ namespace SDF
         {
             actorTileBinding[i] = NULL;
         }
+
+        // Checkpoint belongs to the binding of another application
+        discardCheckpoint();
     }
 
     /**
@@ -933,10 +936,32 @@ namespace SDF
 
     /**
      * releaseResources ()
-     * The function releases all resources allocated by a application.
+     * The function releases all resources allocated by a application. When the
+     * resource occupancy of the architecture was stored before the binding
+     * started, this occupancy is restored at once. Otherwise the resources are
+     * released actor by actor.
      */
     void LoadBalanceBinding::releaseResources()
     {
+        if (checkpoint != NULL && checkpoint->getPlatformGraph() == archGraph)
+        {
+            // Restore resource occupancy before the binding started
+            checkpoint->restore();
+
+            // No actor is bound to a tile
+            for (uint i = 0; i < actorTileBinding.size(); i++)
+                actorTileBinding[i] = NULL;
+
+            // No load on the tiles
+            if (tileLoad != NULL)
+            {
+                for (uint i = 0; i < archGraph->nrTiles(); i++)
+                    tileLoad[i] = 0;
+            }
+
+            return;
+        }
+
         for (SDFactorsIter iter = appGraph->actorsBegin();
              iter != appGraph->actorsEnd(); iter++)
         {
@@ -2323,6 +2348,9 @@ namespace SDF
         // Initialize the load of the tiles
         initTileLoad();
 
+        // Store resource occupancy before binding the application
+        createCheckpoint();
+
 #ifdef VERBOSE
         cerr << "[INFO] Binding" << endl;
 #endif
@@ -2390,6 +2418,9 @@ namespace SDF
         // Initialize the load of the tiles
         initTileLoad();
 
+        // Store resource occupancy before binding the application
+        createCheckpoint();
+
 #ifdef VERBOSE
         cerr << "[INFO] Binding" << endl;
 #endif
@@ -2402,19 +2433,7 @@ namespace SDF
 #endif
 
             // Release allocated resources on failure
-            for (SDFactorsIter iter = appGraph->actorsBegin();
-                 iter != appGraph->actorsEnd(); iter++)
-            {
-                TimedSDFactor *a = (TimedSDFactor *)(*iter);
-                Tile *t = actorTileBinding[a->getId()];
-
-                // Actor bound to tile?
-                if (t != NULL)
-                {
-                    // Release resources reserved by actor (including channels)
-                    releaseResources(a, t);
-                }
-            }
+            releaseResources();
 
             return false;
         }
@@ -46,6 +46,7 @@
 #include "base/algo/acyclic.h"
 #include "base/algo/components.h"
 #include "base/algo/connected.h"
+#include "base/algo/csr.h"
 #include "base/algo/cycle.h"
 #include "base/algo/dfs.h"
 #include "base/algo/repetition_vector.h"
@@ -68,6 +69,7 @@
 // Resource allocation (MP-SoC architecture)
 #include "resource_allocation/mpsoc_arch/arch_types.h"
 #include "resource_allocation/mpsoc_arch/binding.h"
+#include "resource_allocation/mpsoc_arch/checkpoint.h"
 #include "resource_allocation/mpsoc_arch/component.h"
 #include "resource_allocation/mpsoc_arch/connection.h"
 #include "resource_allocation/mpsoc_arch/graph.h"
@@ -98,6 +100,7 @@
 // Graph transformations
 #include "transform/model/autoconc.h"
 #include "transform/model/buffersize.h"
+#include "transform/model/overlay.h"
 #include "transform/to_apg/apg.h"
 #include "transform/to_apg/sdftoapg.h"
 #include "transform/hsdf/hsdf.h"
@@ -66,6 +66,13 @@ namespace SDF
         // Switch argument(s) given to analysis algorithm
         CPairs arguments;
 
+        // Memory limit (MB) for the states of a state-space analysis
+        // (0 = no limit)
+        unsigned long long stateMemory;
+
+        // Print hits and misses of the graph caches
+        bool cacheStatistics;
+
         // Application graph
         CNode *xmlAppGraph;
 
@@ -91,10 +98,18 @@ namespace SDF
         out << "SDF3 " << TOOL << " (version " << DOTTED_VERSION ")" << endl;
         out << endl;
         out << "Usage: " << TOOL << " --graph <file> --algo <algorithm>";
-        out << " [--output <file>]";
+        out << " [--output <file> --state-memory <MB> --cache-statistics]";
         out << endl;
         out << "   --graph  <file>     input SDF graph" << endl;
         out << "   --output <file>     output file (default: stdout)" << endl;
+        out << "   --state-memory <MB> move states of a state-space analysis";
+        out << " to disk when" << endl;
+        out << "                       they exceed <MB> MB of memory (the";
+        out << " index of about" << endl;
+        out << "                       40 bytes per state is counted but";
+        out << " stays in memory)" << endl;
+        out << "   --cache-statistics  print hits and misses of the graph";
+        out << " caches" << endl;
         out << "   --algo <algorithm>  analyze the graph with requested algorithm:";
         out << endl;
         out << "       consistency" << endl;
@@ -105,21 +120,27 @@ namespace SDF
         out << "       repetition_vector" << endl;
         out << "       repetition_vector_sum" << endl;
         out << "       strongly_connected_components" << endl;
-        out << "       mcm[(cycle,dasdan,karp,howard,yto,yto-mcr)]" << endl;
+        out << "       mcm[(cycle,dasdan,karp,howard,yto,yto-mcr,yto-sdf)]" << endl;
+        out << "       mcm(cycle|yto|yto-mcr,threads)" << endl;
         out << "       mpthroughput" << endl;
         out << "       mpdelay" << endl;
         out << "       mpeigen" << endl;
         out << "       mpconverthsdf" << endl;
         out << "       is_hsdf" << endl;
         out << "       statistics" << endl;
-        out << "       throughput" << endl;
-        out << "       buffersize" << endl;
+        out << "       throughput[(symmetry,brent)]" << endl;
+        out << "       buffersize[(thrBound,thrBound,...)]" << endl;
+        out << "       buffersize_anytime(thrBound[,seconds[,distributions]])";
+        out << endl;
         out << "       buffersize_ning_gao" << endl;
         out << "       buffersize_ning_gao_hijdra" << endl;
         out << "       buffersize_capacity_constrained" << endl;
         out << "       latency(method,srcActor,dstActor)" << endl;
+        out << "       latency(st,srcActor,dstActor[,brent])" << endl;
+        out << "       latency(ro,srcActor,dstActor[,attempts[,threads[,seed";
+        out << "[,lowerBound]]]])" << endl;
         out << "       binding_aware_throughput([NSoC,MPFlow])" << endl;
-        out << "       static_periodic_schedule" << endl;
+        out << "       static_periodic_schedule[(brent)]" << endl;
         out << "       static_periodic_schedule_chao" << endl;
     }
 
@@ -228,6 +249,15 @@ namespace SDF
                 arg++;
                 settings.arguments = parseSwitchArgument(argv[arg]);
             }
+            else if (argv[arg] == CString("--state-memory") && arg + 1 < argc)
+            {
+                arg++;
+                settings.stateMemory = CString(argv[arg]);
+            }
+            else if (argv[arg] == CString("--cache-statistics"))
+            {
+                settings.cacheStatistics = true;
+            }
             else
             {
                 helpMessage(cerr);
@@ -336,6 +366,8 @@ namespace SDF
     void initSettings(int argc, char **argv)
     {
         // Parse the command line
+        settings.stateMemory = 0;
+        settings.cacheStatistics = false;
         parseCommandLine(argc, argv);
 
         // Check required settings
@@ -345,6 +377,10 @@ namespace SDF
             throw CException("");
         }
 
+        // Memory limit of the states stored by a state-space analysis
+        SDFstateSpaceStateStore::setDefaultMemoryLimit(
+            settings.stateMemory * 1024 * 1024);
+
         // Load application graph
         settings.xmlAppGraph = loadApplicationGraphFromFile(settings.graphFile,
                                MODULE);
@@ -357,6 +393,34 @@ namespace SDF
         settings.xmlMapping = loadMappingFromFile(settings.graphFile, MODULE);
     }
 
+    /**
+     * outputStorageDistributionSet ()
+     * The function outputs the storage distribution set p of the graph g in
+     * XML. Every line is preceded by the indentation.
+     */
+    void outputStorageDistributionSet(TimedSDFgraph *g,
+                                      StorageDistributionSet *p,
+                                      const CString &indent, ostream &out)
+    {
+        out << indent << "<distributionsSet thr='";
+        out << p->thr;
+        out << "' sz='" << p->sz << "'>" << endl;
+        for (StorageDistribution *d = p->distributions;
+             d != nullptr; d = d->next)
+        {
+            out << indent << "    <distribution>" << endl;
+            for (uint c = 0; c < g->nrChannels(); c++)
+            {
+                out << indent << "        <ch name='";
+                out << g->getChannel(c)->getName();
+                out << "' sz='" << d->sp[c];
+                out << "'/>" << endl;
+            }
+            out << indent << "    </distribution>" << endl;
+        }
+        out << indent << "</distributionsSet>" << endl;
+    }
+
     /**
      * analyzeSDFG ()
      * The function analyzes the SDF graph.
@@ -465,35 +529,64 @@ namespace SDF
         {
             CDouble mcm;
             TimedSDFgraph *hsdfGraph;
+            CString method = "cycle";
+            uint nrThreads = 1;
+            CStrings options;
+
+            // Extract algorithm and number of threads supplied with mcm switch
+            stringtok(options, analyze.front().value, ",");
+            if (options.size() > 2)
+                throw CException("Incorrect number of options given.");
+            if (!options.empty())
+            {
+                method = options.front();
+                options.pop_front();
+            }
+            if (!options.empty())
+            {
+                nrThreads = options.front();
+                if (nrThreads == 0)
+                    throw CException("Number of threads must be positive.");
+                if (method != "cycle" && method != "yto" && method != "yto-mcr")
+                    throw CException("Algorithm does not support threads.");
+            }
 
             // Measure execution time
             startTimer(&timer);
 
-            hsdfGraph = (TimedSDFgraph *)transformSDFtoHSDF(g);
+            // Graph with one node per initial token is built without HSDF
+            if (method == "yto-sdf")
+                hsdfGraph = nullptr;
+            else
+                hsdfGraph = (TimedSDFgraph *)getHSDFgraph(g);
 
-            if (analyze.front().value.empty() || analyze.front().value == "cycle")
+            if (method == "cycle")
             {
-                mcm = maximumCycleMeanCycles(hsdfGraph);
+                mcm = maximumCycleMeanCycles(hsdfGraph, nrThreads);
             }
-            else if (analyze.front().value == "dasdan")
+            else if (method == "dasdan")
             {
                 mcm = maximumCycleMeanDasdanGupta(hsdfGraph);
             }
-            else if (analyze.front().value == "karp")
+            else if (method == "karp")
             {
                 mcm = maximumCycleMeanKarp(hsdfGraph);
             }
-            else if (analyze.front().value == "howard")
+            else if (method == "howard")
             {
                 mcm = maximumCycleMeanHoward(hsdfGraph);
             }
-            else if (analyze.front().value == "yto")
+            else if (method == "yto")
             {
-                mcm = maximumCycleYoungTarjanOrlin(hsdfGraph, true);
+                mcm = maximumCycleYoungTarjanOrlin(hsdfGraph, true, nrThreads);
             }
-            else if (analyze.front().value == "yto-mcr")
+            else if (method == "yto-mcr")
             {
-                mcm = maximumCycleYoungTarjanOrlin(hsdfGraph, false);
+                mcm = maximumCycleYoungTarjanOrlin(hsdfGraph, false, nrThreads);
+            }
+            else if (method == "yto-sdf")
+            {
+                mcm = maximumCycleMeanSDFYoungTarjanOrlin(g);
             }
             else
             {
@@ -508,14 +601,28 @@ namespace SDF
             out << "analysis time: ";
             printTimer(out, &timer);
             out << endl;
-
-            delete hsdfGraph;
         }
         else if (analyze.front().key == "throughput")
         {
             SDFstateSpaceThroughputAnalysis thrAnalysisAlgo;
             double thr;
 
+            CStrings options;
+
+            // Reduce the state-space with symmetries between actors and/or
+            // detect the recurrent state with Brent's algorithm?
+            stringtok(options, analyze.front().value, ",");
+            for (CStringsIter iter = options.begin(); iter != options.end();
+                 iter++)
+            {
+                if (*iter == "symmetry")
+                    thrAnalysisAlgo.setSymmetryReduction(true);
+                else if (*iter == "brent")
+                    thrAnalysisAlgo.setCycleDetection(true);
+                else
+                    throw CException("Unknown throughput option.");
+            }
+
             // Measure execution time
             startTimer(&timer);
 
@@ -584,8 +691,21 @@ namespace SDF
         {
             StorageDistributionSet *minStorageDistributions;
             SDFstateSpaceBufferAnalysis bufferAnalysisAlgo;
+            vector<double> thrBounds;
+            CStrings options;
 
-            minStorageDistributions = bufferAnalysisAlgo.analyze(g);
+            // Throughput bounds (sorted in increasing order)
+            stringtok(options, analyze.front().value, ",");
+            for (CStringsIter iter = options.begin(); iter != options.end();
+                 iter++)
+            {
+                thrBounds.push_back(*iter);
+                if (thrBounds.size() > 1
+                    && thrBounds.back() < thrBounds[thrBounds.size() - 2])
+                {
+                    throw CException("Throughput bounds must be sorted.");
+                }
+            }
 
             out << "<?xml version='1.0' encoding='UTF-8'?>" << endl;
             out << "<sdf3 type='sdf' version='1.0'" << endl;
@@ -593,26 +713,94 @@ namespace SDF
             out << "      >" << endl;
             out << "    <storageThroughputTradeOffs>" << endl;
 
-            for (StorageDistributionSet *p = minStorageDistributions; p != nullptr;
-                 p = p->next)
+            if (thrBounds.empty())
             {
-                out << "        <distributionsSet thr='";
-                out << p->thr;
-                out << "' sz='" << p->sz << "'>" << endl;
-                for (StorageDistribution *d = p->distributions;
-                     d != nullptr; d = d->next)
+                minStorageDistributions = bufferAnalysisAlgo.analyze(g);
+
+                for (StorageDistributionSet *p = minStorageDistributions;
+                     p != nullptr; p = p->next)
                 {
-                    out << "            <distribution>" << endl;
-                    for (uint c = 0; c < g->nrChannels(); c++)
+                    outputStorageDistributionSet(g, p, "        ", out);
+                }
+            }
+            else
+            {
+                // One search for all bounds, output every bound once it is met
+                bufferAnalysisAlgo.initSearch(g);
+                for (uint i = 0; i < thrBounds.size(); i++)
+                {
+                    StorageDistributionSet *p;
+
+                    p = bufferAnalysisAlgo.findStorageDistributionSet(
+                            thrBounds[i]);
+
+                    out << "        <throughputBound thr='" << thrBounds[i];
+                    if (p == nullptr)
                     {
-                        out << "                <ch name='";
-                        out << g->getChannel(c)->getName();
-                        out << "' sz='" << d->sp[c];
                         out << "'/>" << endl;
                     }
-                    out << "            </distribution>" << endl;
+                    else
+                    {
+                        out << "'>" << endl;
+                        outputStorageDistributionSet(g, p, "            ", out);
+                        out << "        </throughputBound>" << endl;
+                    }
+                    out.flush();
                 }
-                out << "        </distributionsSet>" << endl;
+            }
+
+            out << "    </storageThroughputTradeOffs>" << endl;
+            out << "</sdf3>" << endl;
+        }
+        else if (analyze.front().key == "buffersize_anytime")
+        {
+            SDFstateSpaceBufferAnalysis bufferAnalysisAlgo;
+            StorageDistributionSet *p;
+            double maxSeconds = 0;
+            unsigned long maxDistributions = 0;
+            TBufSize lowerBound;
+            double thrBound;
+            CStrings options;
+
+            // Throughput bound and optional time and exploration budget
+            stringtok(options, analyze.front().value, ",");
+            if (options.empty())
+                throw CException("No throughput bound specified.");
+            thrBound = options.front();
+            options.pop_front();
+            if (!options.empty())
+            {
+                maxSeconds = options.front();
+                options.pop_front();
+            }
+            if (!options.empty())
+            {
+                maxDistributions = options.front();
+                options.pop_front();
+            }
+
+            p = bufferAnalysisAlgo.analyzeAnytime(g, thrBound, lowerBound,
+                                                  maxSeconds, maxDistributions);
+
+            out << "<?xml version='1.0' encoding='UTF-8'?>" << endl;
+            out << "<sdf3 type='sdf' version='1.0'" << endl;
+            out << "     xmlns:xsi='http://www.w3.org/2001/XMLSchema-instance'" << endl;
+            out << "      >" << endl;
+            out << "    <storageThroughputTradeOffs>" << endl;
+            out << "        <throughputBound thr='" << thrBound;
+            out << "' lowerBound='" << lowerBound;
+            if (p == nullptr)
+            {
+                out << "'/>" << endl;
+            }
+            else
+            {
+                // Optimality gap of the best known distribution
+                out << "' gap='" << p->sz - lowerBound;
+                out << "' optimal='" << (p->sz == lowerBound ? "true" : "false");
+                out << "'>" << endl;
+                outputStorageDistributionSet(g, p, "            ", out);
+                out << "        </throughputBound>" << endl;
             }
             out << "    </storageThroughputTradeOffs>" << endl;
             out << "</sdf3>" << endl;
@@ -725,12 +913,14 @@ namespace SDF
         else if (analyze.front().key == "buffersize_capacity_constrained")
         {
             StorageDistributionSet *minStorageDistributions;
-            TimedSDFgraph *gNoConcurrency, *gConstrained;
+            TimedSDFgraphOverlay overlay(g);
+            TimedSDFgraph *gNoConcurrency = overlay.getGraph(), *gConstrained;
+            uint nrChannels = g->nrChannels();
             CDouble mcm;
             double maxThr;
 
             // Exclude auto-concurrency
-            gNoConcurrency = (TimedSDFgraph *)modelAutoConcurrencyInSDFgraph(g, 1);
+            overlay.modelAutoConcurrency(1);
 
             // Compute maximal throughput and MCM
             mcm = maximumCycleMeanCycles(gNoConcurrency);
@@ -788,7 +978,7 @@ namespace SDF
 
                             // Channel ch of which storage space is modeled with
                             // channel c appears in the original graph g?
-                            if (g->getChannel(ch->getName()) != nullptr)
+                            if (ch->getId() < nrChannels)
                             {
                                 // Channel is not a self-edge added to remove
                                 // auto-concurrency
@@ -807,7 +997,6 @@ namespace SDF
             out << "</sdf3>" << endl;
 
             // Cleanup
-            delete gNoConcurrency;
             delete gConstrained;
         }
         else if (analyze.front().key == "latency")
@@ -816,11 +1005,20 @@ namespace SDF
             SDFactor *srcActor, *dstActor;
             CStrings options;
             double latency, thr = -1.0;
+            uint nrAttempts = 100, nrThreads = 1, seed = 0;
+            SDFtime lowerBound = 0;
+            bool cycleDetection = false;
 
             // Extract options supplied with latency switch
             stringtok(options, analyze.front().value, ",");
-            if (options.size() != 3)
+            if (options.size() < 3
+                || (options.size() > 3 && options.front() != "ro"
+                    && options.front() != "st")
+                || (options.size() > 4 && options.front() == "st")
+                || options.size() > 7)
+            {
                 throw CException("Incorrect number of options given.");
+            }
             method = options.front();
             options.pop_front();
             srcActorName = options.front();
@@ -828,6 +1026,38 @@ namespace SDF
             dstActorName = options.front();
             options.pop_front();
 
+            // Optional recurrent-state detection of self-timed execution
+            if (method == "st" && !options.empty())
+            {
+                if (options.front() != "brent")
+                    throw CException("Unknown latency option.");
+                cycleDetection = true;
+                options.pop_front();
+            }
+
+            // Optional attempts, threads, seed and lower bound of random
+            // static-order
+            if (!options.empty())
+            {
+                nrAttempts = options.front();
+                options.pop_front();
+            }
+            if (!options.empty())
+            {
+                nrThreads = options.front();
+                options.pop_front();
+            }
+            if (!options.empty())
+            {
+                seed = options.front();
+                options.pop_front();
+            }
+            if (!options.empty())
+            {
+                lowerBound = options.front();
+                options.pop_front();
+            }
+
             // Find pointer to src and dst actor in graph
             srcActor = g->getActor(srcActorName);
             if (srcActor == nullptr)
@@ -844,6 +1074,7 @@ namespace SDF
             {
                 SDFstateSpaceSelfTimedLatencyAnalysis selftimedLatencyAnalysisAlgo;
 
+                selftimedLatencyAnalysisAlgo.setCycleDetection(cycleDetection);
                 selftimedLatencyAnalysisAlgo.analyze(g, srcActor, dstActor,
                                                      latency, thr);
             }
@@ -865,7 +1096,8 @@ namespace SDF
             {
 
                 latency = latencyAnalysisForRandomStaticOrderSingleProc(
-                              g, srcActor, dstActor, 100);
+                              g, srcActor, dstActor, nrAttempts, nrThreads, seed,
+                              lowerBound);
             }
             else if (method == "min_st")
             {
@@ -951,6 +1183,12 @@ namespace SDF
         {
             SDFstateSpaceStaticPeriodicScheduler scheduler;
 
+            // Detect the recurrent state with Brent's algorithm?
+            if (analyze.front().value == "brent")
+                scheduler.setCycleDetection(true);
+            else if (!analyze.front().value.empty())
+                throw CException("Unknown static-periodic schedule option.");
+
             scheduler.schedule(g);
         }
         else if (analyze.front().key == "static_periodic_schedule_chao")
@@ -1145,6 +1383,10 @@ namespace SDF
         // The actual analysis...
         analyzeSDFG(sdfGraph, settings.arguments, out);
 
+        // Cache statistics
+        if (settings.cacheStatistics)
+            SDFgraphCache::printStatistics(out);
+
         // Cleanup
         delete sdfGraph;
     }
@@ -70,6 +70,9 @@ namespace SDF
         uint maxDetour;
         uint maxNrRipups;
         uint maxNrTries;
+
+        // Number of threads
+        uint nrThreads;
     } Settings;
 
     /**
@@ -99,6 +102,11 @@ namespace SDF
         out << "       knowledge" << endl;
         out << "       random" << endl;
         out << "       classic" << endl;
+        out << "   --threads <n>       number of threads used to solve scheduling";
+        out << endl;
+        out << "                       problems not related through a switch";
+        out << endl;
+        out << "                       (default: 1)" << endl;
     }
 
     /**
@@ -127,6 +135,13 @@ namespace SDF
                 arg++;
                 settings.settingsFile = argv[arg];
             }
+            else if (argv[arg] == CString("--threads") && arg + 1 < argc)
+            {
+                arg++;
+                settings.nrThreads = CString(argv[arg]);
+                if (settings.nrThreads == 0)
+                    throw CException("Number of threads must be > 0.");
+            }
             else
             {
                 helpMessage(cerr);
@@ -355,6 +370,9 @@ namespace SDF
         settings.maxDetour = 0;
         settings.maxNrRipups = 0;
         settings.maxNrTries = 0;
+
+        // Single-threaded
+        settings.nrThreads = 1;
     }
 
     /**
@@ -456,6 +474,7 @@ namespace SDF
         {
             throw CException("[ERROR] Unknown scheduling algorithm.");
         }
+        scheduler->setNrThreads(settings.nrThreads);
 
         // Create a set of scheduling problems
         problems = new SetOfNoCScheduleProblems(settings.xmlMessagesSet,
@@ -56,12 +56,24 @@ namespace SDF
         out << "SDF3 " << TOOL << " (version " << DOTTED_VERSION ")" << endl;
         out << endl;
         out << "Usage: " << TOOL << " [--settings <file> --output <file>";
-        out << " --step]";
+        out << " --step --cache <dir> --state-memory <MB>";
+        out << " --looped-schedules]";
         out << endl;
         out << "   --settings <file>  settings for algorithms (default: sdf3.opt)";
         out << endl;
         out << "   --output <file>    output file (default:stdout)" << endl;
         out << "   --step             run flow step-by-step" << endl;
+        out << "   --looped-schedules output static-order schedules with";
+        out << " loops" << endl;
+        out << "   --cache <dir>      resume storage-space / throughput";
+        out << " exploration from" << endl;
+        out << "                      (and store it in) directory <dir>" << endl;
+        out << "   --state-memory <MB> move states of a state-space analysis";
+        out << " to disk" << endl;
+        out << "                      when they exceed <MB> MB of memory";
+        out << " (the index of" << endl;
+        out << "                      about 40 bytes per state is counted";
+        out << " but stays in memory)" << endl;
         out << "   --html             output result of flow in HTML" << endl;
         out << endl;
     }
@@ -114,6 +126,18 @@ namespace SDF
         if (settings.stepFlag)
             flow->setStepMode(true);
 
+        // Output static-order schedules with loops?
+        if (settings.loopedSchedulesFlag)
+            flow->setLoopedSchedules(true);
+
+        // Cache storage-space / throughput exploration?
+        if (!settings.cacheDir.empty())
+            flow->setStorageDistributionCache(settings.cacheDir);
+
+        // Memory limit of the states stored by a state-space analysis
+        SDFstateSpaceStateStore::setDefaultMemoryLimit(
+            settings.stateMemory * 1024 * 1024);
+
         // Tile binding and scheduling algorithm
         if (settings.tileMappingAlgo == "loadbalance")
         {
@@ -57,6 +57,13 @@ namespace SDF
         // Run flow step-by-step
         stepFlag = false;
 
+        // Output flat static-order schedules
+        loopedSchedulesFlag = false;
+
+        // No cache for storage-space / throughput explorations
+        cacheDir = "";
+        stateMemory = 0;
+
         // Output results as HTML
         outputAsHTML = false;
 
@@ -164,6 +171,20 @@ namespace SDF
             {
                 stepFlag = true;
             }
+            else if (arg == "--looped-schedules")
+            {
+                loopedSchedulesFlag = true;
+            }
+            else if (arg == "--cache")
+            {
+                cacheDir = argNext;
+                argIter++;
+            }
+            else if (arg == "--state-memory")
+            {
+                stateMemory = argNext;
+                argIter++;
+            }
             else if (arg == "--html")
             {
                 outputAsHTML = true;
@@ -91,6 +91,16 @@ namespace SDF
             // Run flow step-by-step
             bool stepFlag;
 
+            // Output static-order schedules with loops
+            bool loopedSchedulesFlag;
+
+            // Directory with cached storage-space / throughput explorations
+            CString cacheDir;
+
+            // Memory limit (MB) for the states of a state-space analysis
+            // (0 = no limit)
+            unsigned long long stateMemory;
+
             // Output results as HTML
             bool outputAsHTML;
 
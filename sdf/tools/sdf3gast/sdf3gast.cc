@@ -36,6 +36,9 @@
 #include "sdf3gast.h"
 #include "base/base.h"
 #include "../../sdf.h"
+#include <atomic>
+#include <mutex>
+#include <thread>
 using namespace SDF;
 namespace SDF
 {
@@ -76,6 +79,12 @@ namespace SDF
         // Communication trace
         bool communicationTrace;
         uint slotTableSize;
+
+        // Exploration of application orders (number of orders, seed and
+        // number of threads)
+        uint nrOrders;
+        uint seed;
+        uint nrThreads;
     } Settings;
 
     /**
@@ -94,7 +103,9 @@ namespace SDF
         out << endl;
         out << "Usage: " << TOOL << " [--settings <file> --scheduler <algo>";
         out << " --output <file>" << endl;
-        out << "                     --check --stateSpace --communicationTrace]";
+        out << "                     --check --stateSpace --communicationTrace";
+        out << endl;
+        out << "                     --orders <n> --seed <n> --threads <n>]";
         out << endl;
         out << "   --settings  <file>         settings for tool (default: ";
         out << "sdf3.opt)" << endl;
@@ -108,6 +119,16 @@ namespace SDF
         out << " for specified" << endl;
         out << "                              slot table size";
         out << endl;
+        out << "   --orders <n>               admit the applications in n";
+        out << " different orders" << endl;
+        out << "                              and output the order which";
+        out << " admits most" << endl;
+        out << "                              applications" << endl;
+        out << "   --seed <n>                 seed used to shuffle the";
+        out << " applications (default: 0)" << endl;
+        out << "   --threads <n>              number of threads used to";
+        out << " explore the orders" << endl;
+        out << "                              (default: 1)" << endl;
     }
 
     /**
@@ -141,6 +162,23 @@ namespace SDF
                 settings.communicationTrace = true;
                 settings.slotTableSize = CString(argv[arg]);
             }
+            else if (argv[arg] == CString("--orders") && arg + 1 < argc)
+            {
+                arg++;
+                settings.nrOrders = CString(argv[arg]);
+            }
+            else if (argv[arg] == CString("--seed") && arg + 1 < argc)
+            {
+                arg++;
+                settings.seed = CString(argv[arg]);
+            }
+            else if (argv[arg] == CString("--threads") && arg + 1 < argc)
+            {
+                arg++;
+                settings.nrThreads = CString(argv[arg]);
+                if (settings.nrThreads == 0)
+                    throw CException("Number of threads must be positive.");
+            }
             else if (argv[arg] == CString("--settings") && arg + 1 < argc)
             {
                 arg++;
@@ -419,6 +457,11 @@ namespace SDF
         // Communication trace
         settings.communicationTrace = false;
         settings.slotTableSize = 0;
+
+        // Exploration of application orders
+        settings.nrOrders = 0;
+        settings.seed = 0;
+        settings.nrThreads = 1;
     }
 
     /**
@@ -536,16 +579,24 @@ namespace SDF
      */
     bool bindApplicationGraphsToArchitectureGraph(ostream &out, bool check = false)
     {
-        CNode *systemUsageNode, *appGraphNode, *sdfGraphNode, *sdfGraphPropsNode;
+        CNode *appGraphNode, *sdfGraphNode, *sdfGraphPropsNode;
         LoadBalanceBinding loadBalanceBinding(SDFflowTypeNSoC);
+        PlatformGraphCheckpoint *initialUsage;
         bool setBinding, valid = true;
         TimedSDFgraph *appGraph;
         PlatformGraph *archGraph;
         uint nrAppGraphsBound = 0;
         CTimer timer1, timer2;
 
-        // Set initial resource usage information
-        systemUsageNode = settings.xmlSystemUsage;
+        // Construct architecture graph (shared by all applications)
+        archGraph = constructPlatformGraph(settings.xmlArchGraph);
+
+        // Mark all resource occupied by earlier mapped graphs as unavailable
+        if (check == false && settings.xmlSystemUsage != NULL)
+            setUsagePlatformGraph(archGraph, settings.xmlSystemUsage);
+
+        // Resource usage before binding any application
+        initialUsage = new PlatformGraphCheckpoint(archGraph);
 
         // Set constants tile cost function
         loadBalanceBinding.setConstantsTileCostFunction(
@@ -575,12 +626,6 @@ namespace SDF
             appGraph = new TimedSDFgraph();
             appGraph->construct(sdfGraphNode, sdfGraphPropsNode);
 
-            // Construct architecture graph
-            archGraph = constructPlatformGraph(settings.xmlArchGraph);
-
-            // Mark all resource occupied by earlier mapped graphs as unavailable
-            if (check == false)
-                setUsagePlatformGraph(archGraph, systemUsageNode);
 
             // Binding specified for this application and architecture?
             for (CNode *mappingNode = settings.xmlMapping;
@@ -650,10 +695,8 @@ namespace SDF
 
                 outputSystemUsage(cerr, archGraph);
 
-                // Resource usage
-                systemUsageNode = createSystemUsageNode(archGraph);
-
                 // Stop binding applications to architecture
+                delete appGraph;
                 break;
             }
             else
@@ -665,9 +708,6 @@ namespace SDF
                 outputBindingAsXML(archGraph, appGraph, out);
                 out.flush();
 
-                // Resource usage
-                systemUsageNode = createSystemUsageNode(archGraph);
-
                 cerr << "[INFO] Bound " << nrAppGraphsBound;
                 cerr << " applications to architecture." << endl;
 
@@ -681,11 +721,22 @@ namespace SDF
                 }
             }
 
+            // Every application is checked on an otherwise unused architecture.
+            // Otherwise, the resources used by the application are no longer
+            // available to the next application.
+            if (check)
+                initialUsage->restore();
+            else
+                claimBoundResourcesPlatformGraph(archGraph);
+
             // Cleanup
-            delete archGraph;
             delete appGraph;
         }
 
+        // Cleanup
+        delete initialUsage;
+        delete archGraph;
+
         // Timer 1
         stopTimer(&timer1);
         cerr << "Total resource allocation took ";
@@ -697,6 +748,377 @@ namespace SDF
 
         return valid;
     }
+
+    /**
+     * AdmissionOrder
+     * Result of admitting the applications to the platform in one order.
+     */
+    typedef struct _AdmissionOrder
+    {
+        // Order in which the applications are offered to the platform
+        vector<uint> order;
+
+        // Admitted applications (in order of admission)
+        vector<uint> admitted;
+
+        // Average occupation of the platform resources after admission
+        double usage;
+    } AdmissionOrder;
+
+    /**
+     * AdmissionExploration
+     * Work shared by the threads which explore the application orders.
+     */
+    typedef struct _AdmissionExploration
+    {
+        // Application graphs
+        vector<CNode *> appGraphs;
+
+        // Orders to explore and their results
+        vector<AdmissionOrder> orders;
+
+        // Index of the next order to explore
+        std::atomic<uint> nextOrder;
+
+        // First error encountered by any of the threads
+        std::atomic<bool> failed;
+        std::mutex errorLock;
+        CString error;
+    } AdmissionExploration;
+
+    /**
+     * NullStreamBuffer
+     * Stream buffer which discards all output.
+     */
+    class NullStreamBuffer : public std::streambuf
+    {
+        protected:
+            int overflow(int c)
+            {
+                return traits_type::not_eof(c);
+            };
+    };
+
+    /**
+     * resourceUsage ()
+     * The function returns the average occupation (between 0 and 1) of the
+     * processors, memories and network interfaces in the platform graph.
+     */
+    double resourceUsage(PlatformGraph *g)
+    {
+        double usage = 0;
+        uint nrResources = 0;
+
+        for (TilesIter iter = g->tilesBegin(); iter != g->tilesEnd(); iter++)
+        {
+            Tile *t = *iter;
+            Processor *p = t->getProcessor();
+            Memory *m = t->getMemory();
+            NetworkInterface *ni = t->getNetworkInterface();
+
+            if (p != NULL && p->getTimewheelSize() != 0)
+            {
+                usage += (p->getTimewheelSize() - p->availableTimewheelSize())
+                         / (double) p->getTimewheelSize();
+                nrResources++;
+            }
+
+            if (m != NULL && m->getSize() != 0)
+            {
+                usage += (m->getSize() - m->availableMemorySize())
+                         / (double) m->getSize();
+                nrResources++;
+            }
+
+            if (ni != NULL && ni->getNrConnections() != 0)
+            {
+                usage += (ni->getNrConnections() - ni->availableNrConnections())
+                         / (double) ni->getNrConnections();
+                nrResources++;
+            }
+
+            if (ni != NULL && ni->getInBandwidth() != 0)
+            {
+                usage += (ni->getInBandwidth() - ni->availableInBandwidth())
+                         / ni->getInBandwidth();
+                nrResources++;
+            }
+
+            if (ni != NULL && ni->getOutBandwidth() != 0)
+            {
+                usage += (ni->getOutBandwidth() - ni->availableOutBandwidth())
+                         / ni->getOutBandwidth();
+                nrResources++;
+            }
+        }
+
+        if (nrResources == 0)
+            return 0;
+
+        return usage / nrResources;
+    }
+
+    /**
+     * bindApplicationGraph ()
+     * The function binds the application graph to the architecture graph using
+     * the predefined mapping of the application or, when no such mapping
+     * exists, using the requested binding algorithm. The function returns true
+     * when the binding succeeds. Otherwise, it returns false.
+     */
+    bool bindApplicationGraph(LoadBalanceBinding &loadBalanceBinding,
+                              PlatformGraph *archGraph, TimedSDFgraph *appGraph)
+    {
+        bool valid;
+
+        // Binding specified for this application and architecture?
+        for (CNode *mappingNode = settings.xmlMapping;
+             mappingNode != NULL;
+             mappingNode = CNextNode(mappingNode, "mapping"))
+        {
+            if (archGraph->getName() == CGetAttribute(mappingNode, "archGraph")
+                && appGraph->getName() == CGetAttribute(mappingNode, "appGraph"))
+            {
+                setMappingPlatformGraph(archGraph, appGraph, mappingNode);
+                return true;
+            }
+        }
+
+        // Run selected binding algorithm
+        if (settings.tileMappingAlgo != "loadbalance")
+            throw CException("Binding algorithm unknown.");
+
+        loadBalanceBinding.setAppGraph(appGraph);
+        loadBalanceBinding.setArchGraph(archGraph);
+        valid = loadBalanceBinding.bindSDFGtoTiles();
+        if (valid)
+            valid = loadBalanceBinding.constructStaticOrderScheduleTiles();
+        if (valid)
+            valid = loadBalanceBinding.allocateTDMAtimeSlices();
+
+        return valid;
+    }
+
+    /**
+     * admitApplicationGraphs ()
+     * The function offers the application graphs to the architecture graph in
+     * the order stored in the admission. An application which cannot be bound
+     * is rejected and its partial binding is undone. The resources used by an
+     * admitted application remain unavailable to the next applications. When
+     * an output stream is supplied, the binding of every admitted application
+     * is written to it.
+     */
+    void admitApplicationGraphs(PlatformGraph *archGraph,
+                                const vector<CNode *> &appGraphs,
+                                AdmissionOrder &admission, ostream *out = NULL)
+    {
+        LoadBalanceBinding loadBalanceBinding(SDFflowTypeNSoC);
+
+        // Set constants tile cost function
+        loadBalanceBinding.setConstantsTileCostFunction(
+            settings.cnst_a, settings.cnst_b, settings.cnst_c,
+            settings.cnst_d, settings.cnst_e, settings.cnst_f,
+            settings.cnst_g, settings.cnst_k, settings.cnst_l,
+            settings.cnst_m, settings.cnst_n, settings.cnst_o,
+            settings.cnst_p, settings.cnst_q);
+
+        admission.admitted.clear();
+
+        for (uint i = 0; i < admission.order.size(); i++)
+        {
+            CNode *appGraphNode = appGraphs[admission.order[i]];
+            PlatformGraphCheckpoint beforeBinding(archGraph);
+            TimedSDFgraph appGraph;
+
+            // Construct application graph
+            appGraph.construct(CGetChildNode(appGraphNode, "sdf"),
+                               CGetChildNode(appGraphNode, "sdfProperties"));
+
+            if (bindApplicationGraph(loadBalanceBinding, archGraph, &appGraph))
+            {
+                if (out != NULL)
+                    outputBindingAsXML(archGraph, &appGraph, *out);
+
+                claimBoundResourcesPlatformGraph(archGraph);
+                admission.admitted.push_back(admission.order[i]);
+            }
+            else
+            {
+                beforeBinding.restore();
+            }
+        }
+
+        admission.usage = resourceUsage(archGraph);
+    }
+
+    /**
+     * exploreAdmissionOrders ()
+     * Worker thread of the exploration. Every thread binds against its own
+     * platform graph. Before each order, the platform graph is restored to the
+     * resource occupancy described by the system usage.
+     */
+    void exploreAdmissionOrders(AdmissionExploration *exploration)
+    {
+        PlatformGraphCheckpoint *initialUsage = NULL;
+        PlatformGraph *archGraph = NULL;
+        uint i;
+
+        try
+        {
+            archGraph = constructPlatformGraph(settings.xmlArchGraph);
+            if (settings.xmlSystemUsage != NULL)
+                setUsagePlatformGraph(archGraph, settings.xmlSystemUsage);
+            initialUsage = new PlatformGraphCheckpoint(archGraph);
+
+            while (!exploration->failed
+                   && (i = exploration->nextOrder.fetch_add(1))
+                   < exploration->orders.size())
+            {
+                initialUsage->restore();
+                admitApplicationGraphs(archGraph, exploration->appGraphs,
+                                       exploration->orders[i]);
+            }
+        }
+        catch (CException &e)
+        {
+            std::lock_guard<std::mutex> guard(exploration->errorLock);
+
+            if (!exploration->failed)
+            {
+                exploration->error = e.getMessage();
+                exploration->failed = true;
+            }
+        }
+
+        delete initialUsage;
+        delete archGraph;
+    }
+
+    /**
+     * isBetterAdmission ()
+     * The function returns true when admission a admits more applications
+     * than admission b, or the same number of applications using less of the
+     * platform resources.
+     */
+    bool isBetterAdmission(const AdmissionOrder &a, const AdmissionOrder &b)
+    {
+        if (a.admitted.size() != b.admitted.size())
+            return a.admitted.size() > b.admitted.size();
+
+        return a.usage < b.usage;
+    }
+
+    /**
+     * exploreApplicationOrders ()
+     * The function offers the application graphs to the architecture graph in
+     * settings.nrOrders different orders. The first order is the order
+     * specified in the XML file, the other orders are random permutations of
+     * it. The orders are explored by settings.nrThreads threads. The result
+     * of an order does not depend on the thread exploring it, so the selected
+     * order does not depend on the number of threads. The bindings of the
+     * applications admitted in the best order and the resulting system usage
+     * are written to the output stream.
+     * The function returns true if all application graphs are admitted in the
+     * best order. Otherwise, it returns false.
+     */
+    bool exploreApplicationOrders(ostream &out)
+    {
+        AdmissionExploration exploration;
+        NullStreamBuffer nullBuffer;
+        vector<std::thread> threads;
+        std::streambuf *cerrBuffer;
+        PlatformGraph *archGraph;
+        AdmissionOrder best;
+        uint nrAppGraphs;
+        CTimer timer;
+
+        // Application graphs
+        for (list<CNode *>::iterator iter = settings.xmlAppGraphs.begin();
+             iter != settings.xmlAppGraphs.end(); iter++)
+        {
+            exploration.appGraphs.push_back(*iter);
+        }
+        nrAppGraphs = exploration.appGraphs.size();
+
+        // Orders (order i > 0 is a permutation seeded with seed + i)
+        exploration.orders.resize(settings.nrOrders);
+        for (uint i = 0; i < settings.nrOrders; i++)
+        {
+            vector<uint> &order = exploration.orders[i].order;
+            MTRand mtRand(settings.seed + i);
+
+            for (uint j = 0; j < nrAppGraphs; j++)
+                order.push_back(j);
+
+            for (uint j = nrAppGraphs; i != 0 && j > 1; j--)
+                std::swap(order[j - 1], order[mtRand.randInt(j - 1)]);
+        }
+        exploration.nextOrder = 0;
+        exploration.failed = false;
+
+        startTimer(&timer);
+
+        // The binding algorithm reports its progress on cerr. The reports of
+        // concurrent threads are useless, so they are discarded.
+        cerrBuffer = cerr.rdbuf(&nullBuffer);
+
+        for (uint t = 1; t < settings.nrThreads && t < settings.nrOrders; t++)
+            threads.push_back(std::thread(exploreAdmissionOrders, &exploration));
+        exploreAdmissionOrders(&exploration);
+
+        for (vector<std::thread>::iterator iter = threads.begin();
+             iter != threads.end(); iter++)
+        {
+            iter->join();
+        }
+
+        cerr.rdbuf(cerrBuffer);
+
+        if (exploration.failed)
+            throw CException(exploration.error);
+
+        stopTimer(&timer);
+
+        // Report all orders and select the best one (first one on a tie)
+        best = exploration.orders[0];
+        for (uint i = 0; i < exploration.orders.size(); i++)
+        {
+            AdmissionOrder &o = exploration.orders[i];
+
+            cerr << "[INFO] Order " << i << ": admitted " << o.admitted.size();
+            cerr << " of " << nrAppGraphs << " applications (";
+            cerr << 100.0 * o.usage << "% of resources occupied)" << endl;
+
+            if (isBetterAdmission(o, best))
+                best = o;
+        }
+
+        cerr << "Exploring " << settings.nrOrders << " orders took ";
+        printTimer(cerr, &timer);
+        cerr << endl;
+
+        // Redo the best order to output its bindings and system usage
+        archGraph = constructPlatformGraph(settings.xmlArchGraph);
+        if (settings.xmlSystemUsage != NULL)
+            setUsagePlatformGraph(archGraph, settings.xmlSystemUsage);
+        admitApplicationGraphs(archGraph, exploration.appGraphs, best, &out);
+        outputSystemUsageAsXML(archGraph, out);
+
+        cerr << "[INFO] Admitted";
+        for (uint i = 0; i < best.admitted.size(); i++)
+        {
+            cerr << " '" << CGetAttribute(exploration.appGraphs[best.admitted[i]],
+                                          "name") << "'";
+        }
+        cerr << endl;
+        cerr << "[INFO] Bound " << best.admitted.size();
+        cerr << " applications to architecture." << endl;
+
+        outputSystemUsage(cerr, archGraph);
+
+        delete archGraph;
+
+        return best.admitted.size() == nrAppGraphs;
+    }
 }//namespace SDF
 
 /**
@@ -719,8 +1141,13 @@ int main(int argc, char **argv)
         else
             ((ostream &)(out)).rdbuf(cout.rdbuf());
 
-        // Run binding algorithm
-        if (bindApplicationGraphsToArchitectureGraph(out, settings.check))
+        // Explore orders of the applications or run binding algorithm
+        if (settings.nrOrders != 0 && settings.check)
+            throw CException("Options --orders and --check cannot be combined.");
+
+        if (settings.nrOrders != 0)
+            exit_status = exploreApplicationOrders(out) ? 0 : 1;
+        else if (bindApplicationGraphsToArchitectureGraph(out, settings.check))
             exit_status = 0;
         else
             exit_status = 1;
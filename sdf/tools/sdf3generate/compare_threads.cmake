@@ -0,0 +1,50 @@
+# Checks that sdf3generate-sdf produces the same graphs independent of the
+# number of threads. The graphs are generated with the same seed using one
+# thread and using THREADS threads, after which every file is compared.
+#
+# Expected definitions:
+#   GENERATOR   sdf3generate-sdf executable
+#   SETTINGS    settings file of the generator
+#   WORK_DIR    directory in which the graphs are written
+#   SEED        seed of the first graph
+#   GRAPHS      number of graphs
+#   THREADS     number of threads of the parallel run
+
+foreach(var GENERATOR SETTINGS WORK_DIR SEED GRAPHS THREADS)
+    if(NOT DEFINED ${var})
+        message(FATAL_ERROR "${var} is not defined.")
+    endif()
+endforeach()
+
+file(REMOVE_RECURSE ${WORK_DIR})
+
+foreach(nrThreads 1 ${THREADS})
+    file(MAKE_DIRECTORY ${WORK_DIR}/threads_${nrThreads})
+    execute_process(
+            COMMAND ${GENERATOR} --settings ${SETTINGS}
+                    --output ${WORK_DIR}/threads_${nrThreads}/graph
+                    --seed ${SEED} --graphs ${GRAPHS} --threads ${nrThreads}
+            RESULT_VARIABLE result
+            ERROR_VARIABLE errors)
+    if(NOT result EQUAL 0)
+        message(FATAL_ERROR "Generator failed with ${nrThreads} thread(s):\n"
+                "${errors}")
+    endif()
+endforeach()
+
+# Graph i must be identical in both runs
+math(EXPR last "${GRAPHS} - 1")
+foreach(i RANGE ${last})
+    set(graph1 ${WORK_DIR}/threads_1/graph_${i}.xml)
+    set(graphN ${WORK_DIR}/threads_${THREADS}/graph_${i}.xml)
+    if(NOT EXISTS ${graph1} OR NOT EXISTS ${graphN})
+        message(FATAL_ERROR "Graph ${i} has not been generated.")
+    endif()
+    execute_process(
+            COMMAND ${CMAKE_COMMAND} -E compare_files ${graph1} ${graphN}
+            RESULT_VARIABLE result)
+    if(NOT result EQUAL 0)
+        message(FATAL_ERROR "Graph ${i} differs between 1 and ${THREADS} "
+                "threads (${graph1} vs ${graphN}).")
+    endif()
+endforeach()
@@ -35,6 +35,9 @@
 
 #include "sdf3generate.h"
 #include "../../sdf.h"
+#include <atomic>
+#include <mutex>
+#include <thread>
 using namespace SDF;
 namespace SDF
 {
@@ -52,6 +55,14 @@ namespace SDF
         // output file
         CString outputFile;
 
+        // Random seed
+        bool seeded;
+        uint seed;
+
+        // Batch generation (number of graphs and threads)
+        uint nrGraphs;
+        uint nrThreads;
+
         // Graph
         bool stronglyConnected;
         bool acyclic;
@@ -142,10 +153,19 @@ namespace SDF
     {
         out << "SDF3 " << TOOL << " (version " << DOTTED_VERSION ")" << endl;
         out << endl;
-        out << "Usage: " << TOOL << " [--settings <file> --output <file>]" << endl;
+        out << "Usage: " << TOOL << " [--settings <file> --output <file>";
+        out << " --seed <n> --graphs <n> --threads <n>]" << endl;
         out << "   --settings  <file>  settings for the graph generator (default: ";
         out << "sdf3.opt)" << endl;
         out << "   --output <file>     output file (default: stdout)" << endl;
+        out << "   --seed <n>          seed of the random number generator" << endl;
+        out << "   --graphs <n>        generate n graphs; graph i is generated";
+        out << " with seed" << endl;
+        out << "                       <n>+i (default seed: 0) and written to";
+        out << " <output>_<i>.xml" << endl;
+        out << "                       (default output: graph)" << endl;
+        out << "   --threads <n>       number of threads used to generate the";
+        out << " graphs (default: 1)" << endl;
     }
 
     /**
@@ -169,6 +189,24 @@ namespace SDF
                 arg++;
                 settings.settingsFile = argv[arg];
             }
+            else if (argv[arg] == CString("--seed") && arg + 1 < argc)
+            {
+                arg++;
+                settings.seeded = true;
+                settings.seed = CString(argv[arg]);
+            }
+            else if (argv[arg] == CString("--graphs") && arg + 1 < argc)
+            {
+                arg++;
+                settings.nrGraphs = CString(argv[arg]);
+            }
+            else if (argv[arg] == CString("--threads") && arg + 1 < argc)
+            {
+                arg++;
+                settings.nrThreads = CString(argv[arg]);
+                if (settings.nrThreads == 0)
+                    throw CException("Number of threads must be positive.");
+            }
             else
             {
                 helpMessage(cerr);
@@ -392,6 +430,10 @@ namespace SDF
     void setDefaults()
     {
         settings.settingsFile = "sdf3.opt";
+        settings.seeded = false;
+        settings.seed = 0;
+        settings.nrGraphs = 0;
+        settings.nrThreads = 1;
         settings.stronglyConnected = false;
         settings.acyclic = false;
         settings.multigraph = true;
@@ -464,7 +506,7 @@ namespace SDF
      * generateRandomSDFG ()
      * Generate a random SDF graph which is connected, consistent and deadlock-free.
      */
-    void generateRandomSDFG(ostream &out)
+    TimedSDFgraph *generateRandomSDFG()
     {
         TimedSDFgraph *sdfGraph;
 
@@ -497,7 +539,97 @@ namespace SDF
                                    settings.varLatency, settings.minLatency,
                                    settings.maxLatency, settings.integerMCM);
 */
-        outputSDFasXML(sdfGraph, out);
+        return sdfGraph;
+    }
+
+    /**
+     * BatchGeneration
+     * Work shared by the threads which generate a batch of graphs.
+     */
+    typedef struct _BatchGeneration
+    {
+        // Index of the next graph to generate
+        std::atomic<uint> nextGraph;
+
+        // First error encountered by any of the threads
+        std::atomic<bool> failed;
+        std::mutex errorLock;
+        CString error;
+    } BatchGeneration;
+
+    /**
+     * generateRandomSDFGs ()
+     * Worker thread of the batch generation. The graphs are claimed one at a
+     * time. The generator is seeded per graph, so the graph written to a file
+     * does not depend on the thread generating it nor on the number of threads.
+     */
+    void generateRandomSDFGs(BatchGeneration *batch)
+    {
+        uint i;
+
+        while (!batch->failed
+               && (i = batch->nextGraph.fetch_add(1)) < settings.nrGraphs)
+        {
+            try
+            {
+                TimedSDFgraph *sdfGraph;
+                CString fileName;
+                ofstream out;
+
+                fileName = settings.outputFile + "_" + CString(i) + ".xml";
+
+                seedSDFgraphGenerator(settings.seed + i);
+                sdfGraph = generateRandomSDFG();
+
+                out.open(fileName.c_str());
+                if (!out.is_open())
+                    throw CException("Failed opening '" + fileName + "'.");
+                outputSDFasXML(sdfGraph, out);
+                out.close();
+
+                delete sdfGraph;
+            }
+            catch (CException &e)
+            {
+                std::lock_guard<std::mutex> guard(batch->errorLock);
+
+                if (!batch->failed)
+                {
+                    batch->error = e.getMessage();
+                    batch->failed = true;
+                }
+            }
+        }
+    }
+
+    /**
+     * generateRandomSDFGbatch ()
+     * Generate settings.nrGraphs random SDF graphs using settings.nrThreads
+     * threads.
+     */
+    void generateRandomSDFGbatch()
+    {
+        vector<std::thread> threads;
+        BatchGeneration batch;
+
+        if (settings.outputFile.empty())
+            settings.outputFile = "graph";
+
+        batch.nextGraph = 0;
+        batch.failed = false;
+
+        for (uint t = 1; t < settings.nrThreads && t < settings.nrGraphs; t++)
+            threads.push_back(std::thread(generateRandomSDFGs, &batch));
+        generateRandomSDFGs(&batch);
+
+        for (vector<std::thread>::iterator iter = threads.begin();
+             iter != threads.end(); iter++)
+        {
+            iter->join();
+        }
+
+        if (batch.failed)
+            throw CException(batch.error);
     }
 }//namespace SDF
 
@@ -508,6 +640,7 @@ namespace SDF
 int main(int argc, char **argv)
 {
     int exit_status = 0;
+    TimedSDFgraph *sdfGraph;
     ofstream out;
 
     try
@@ -515,6 +648,13 @@ int main(int argc, char **argv)
         // Initialize the program
         initSettings(argc, argv);
 
+        // Generate a batch of random graphs
+        if (settings.nrGraphs != 0)
+        {
+            generateRandomSDFGbatch();
+            return exit_status;
+        }
+
         // Set output stream
         if (!settings.outputFile.empty())
             out.open(settings.outputFile.c_str());
@@ -522,7 +662,11 @@ int main(int argc, char **argv)
             ((ostream &)(out)).rdbuf(cout.rdbuf());
 
         // Generate random graph
-        generateRandomSDFG(out);
+        if (settings.seeded)
+            seedSDFgraphGenerator(settings.seed);
+        sdfGraph = generateRandomSDFG();
+        outputSDFasXML(sdfGraph, out);
+        delete sdfGraph;
     }
     catch (CException &e)
     {
@@ -37,7 +37,24 @@
 #include "../../base/algo/repetition_vector.h"
 namespace SDF
 {
+    /**
+     * CachedHSDFgraph
+     * HSDF graph stored in the cache of an SDF graph.
+     */
+    class CachedHSDFgraph : public SDFgraphCache::Artifact
+    {
+        public:
+            // Constructor
+            CachedHSDFgraph(SDFGraph *h) : hsdfGraph(h) {};
+
+            // Destructor
+            ~CachedHSDFgraph()
+            {
+                delete hsdfGraph;
+            };
 
+            SDFGraph *hsdfGraph;
+    };
 
     /**
      * transformSDFtoHSDF ()
@@ -51,6 +68,9 @@ namespace SDF
         SDFcomponent component = SDFcomponent(NULL, 0);
         h = g->createCopy(component);
 
+        // Components of the new graph are placed in its arena
+        SDFarena::Scope arenaScope(h->createArena());
+
         // Calculate repetition vector for the graph
         RepetitionVector repetitionVector = computeRepetitionVector(g);
 
@@ -140,4 +160,26 @@ namespace SDF
         return h;
     }
 
+    /**
+     * getHSDFgraph ()
+     * The function returns the HSDF graph of the SDF graph g. The HSDF graph is
+     * cached on g and owned by its cache. It must not be modified or deleted
+     * and it is valid till g is changed.
+     */
+    SDFGraph *getHSDFgraph(SDFGraph *g)
+    {
+        SDFgraphCache::Artifact *cached;
+        SDFGraph *h;
+
+        cached = g->getCache().lookup(SDFgraphCache::HSDFgraphArtifact);
+        if (cached != NULL)
+            return ((CachedHSDFgraph *)cached)->hsdfGraph;
+
+        h = transformSDFtoHSDF(g);
+        g->getCache().store(SDFgraphCache::HSDFgraphArtifact,
+                            new CachedHSDFgraph(h));
+
+        return h;
+    }
+
 }//namespace SDF
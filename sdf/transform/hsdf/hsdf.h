@@ -47,5 +47,13 @@ namespace SDF
      */
     SDFGraph *transformSDFtoHSDF(SDFGraph *g);
 
+    /**
+     * getHSDFgraph ()
+     * The function returns the HSDF graph of the SDF graph g. The HSDF graph is
+     * cached on g and owned by its cache. It must not be modified or deleted
+     * and it is valid till g is changed.
+     */
+    SDFGraph *getHSDFgraph(SDFGraph *g);
+
 }//namespace SDF
 #endif
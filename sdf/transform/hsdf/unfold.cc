@@ -41,24 +41,63 @@ namespace SDF
 
     /**
      * unfoldHSDF ()
-     * The function unfolds an HSDF graph for N times.
+     * The function unfolds an HSDF graph for N times. Copy i of an actor or
+     * port is found through index arithmetic on the position of the original
+     * in graph g, so no name lookups are needed to connect the channels.
      */
     SDFGraph *unfoldHSDF(SDFGraph *g, const uint N)
     {
+        vector<SDFport *> hPorts;
+        vector<CString> suffix;
+        v_uint actorIndex, portBase;
+        uint nrPorts = 0;
         SDFGraph *h;
 
         // Check that graph g is an HSDF graph
         if (!isHSDFgraph(g))
             throw CException("Graph is not an HSDF graph.");
 
+        if (N == 0)
+            throw CException("Unfolding factor must be positive.");
+
         // Construct a new HSDF graph
         SDFcomponent component = SDFcomponent(NULL, 0);
         h = g->createCopy(component);
 
+        // Components of the new graph are placed in its arena
+        SDFarena::Scope arenaScope(h->createArena());
+
+        // Suffix of the name of copy i of a component
+        for (uint i = 0; i < N; i++)
+            suffix.push_back(CString("_") + CString(i));
+
+        // Position of each actor and the first port index of its ports
+        for (SDFactorsIter iter = g->actorsBegin(); iter != g->actorsEnd(); iter++)
+        {
+            SDFactor *gA = *iter;
+            uint maxPortId = 0;
+
+            if (gA->getId() >= actorIndex.size())
+                actorIndex.resize(gA->getId() + 1);
+            actorIndex[gA->getId()] = portBase.size();
+
+            for (SDFportsIter iter = gA->portsBegin();
+                 iter != gA->portsEnd(); iter++)
+            {
+                if ((*iter)->getId() + 1 > maxPortId)
+                    maxPortId = (*iter)->getId() + 1;
+            }
+
+            portBase.push_back(nrPorts);
+            nrPorts += maxPortId;
+        }
+        hPorts.resize(nrPorts * N, NULL);
+
         // Actors
         for (SDFactorsIter iter = g->actorsBegin(); iter != g->actorsEnd(); iter++)
         {
             SDFactor *gA = *iter;
+            uint base = portBase[actorIndex[gA->getId()]];
 
             // Create N copies of the actor A in G
             for (uint i = 0; i < N; i++)
@@ -66,7 +105,7 @@ namespace SDF
                 // Create actor a
                 component = SDFcomponent(h, h->nrActors());
                 SDFactor *a = gA->createCopy(component);
-                a->setName(gA->getName() + CString("_") + CString(i));
+                a->setName(gA->getName() + suffix[i]);
 
                 // Create ports on actor a
                 for (SDFportsIter iter = gA->portsBegin();
@@ -80,6 +119,7 @@ namespace SDF
 
                     // Add port to actor
                     a->addPort(p);
+                    hPorts[(base + gP->getId()) * N + i] = p;
                 }
 
                 // Add actor to graph
@@ -92,58 +132,31 @@ namespace SDF
              iter != g->channelsEnd(); iter++)
         {
             SDFchannel *gC = *iter;
-
+            SDFport *gSrcP = gC->getSrcPort();
+            SDFport *gDstP = gC->getDstPort();
             uint d = gC->getInitialTokens();
 
-            for (uint l = 0; l < d % N; l++)
-            {
-                uint k = N + l - d % N;
-
-                // Source and destination port
-                SDFport *hSrcP = h->getActor(gC->getSrcActor()->getName()
-                                             + CString("_") + CString(k)
-                                            )->getPort(gC->getSrcPort()->getName());
-                SDFport *hDstP = h->getActor(gC->getDstActor()->getName()
-                                             + CString("_") + CString(l)
-                                            )->getPort(gC->getDstPort()->getName());
+            // Copies of the source and destination port
+            SDFport **hSrcP = &hPorts[(portBase[actorIndex[gSrcP->getActor()->getId()]]
+                                       + gSrcP->getId()) * N];
+            SDFport **hDstP = &hPorts[(portBase[actorIndex[gDstP->getActor()->getId()]]
+                                       + gDstP->getId()) * N];
 
-                // Create channel c
-                component = SDFcomponent(h, h->nrChannels());
-                SDFchannel *c = gC->createCopy(component);
-                c->setName(gC->getName() + CString("_") + CString(l));
-                c->connectSrc(hSrcP);
-                c->connectDst(hDstP);
-
-                // Initial tokens
-                uint t = (uint)floor((double)(d) / (double)(N)) + 1;
-                c->setInitialTokens(t);
-
-                // Add channel to graph
-                h->addChannel(c);
-            }
-
-            for (uint l = d % N; l < N; l++)
+            for (uint l = 0; l < N; l++)
             {
-                uint k = l - d % N;
-
-                // Source and destination port
-                SDFport *hSrcP = h->getActor(gC->getSrcActor()->getName()
-                                             + CString("_") + CString(k)
-                                            )->getPort(gC->getSrcPort()->getName());
-                SDFport *hDstP = h->getActor(gC->getDstActor()->getName()
-                                             + CString("_") + CString(l)
-                                            )->getPort(gC->getDstPort()->getName());
+                // Copy l of the destination consumes the tokens produced by
+                // copy k of the source, d % N of them cross an iteration more
+                uint k = (l < d % N) ? N + l - d % N : l - d % N;
 
                 // Create channel c
                 component = SDFcomponent(h, h->nrChannels());
                 SDFchannel *c = gC->createCopy(component);
-                c->setName(gC->getName() + CString("_") + CString(l));
-                c->connectSrc(hSrcP);
-                c->connectDst(hDstP);
+                c->setName(gC->getName() + suffix[l]);
+                c->connectSrc(hSrcP[k]);
+                c->connectDst(hDstP[l]);
 
                 // Initial tokens
-                uint t = (uint)floor((double)(d) / (double)(N));
-                c->setInitialTokens(t);
+                c->setInitialTokens(d / N + (l < d % N ? 1 : 0));
 
                 // Add channel to graph
                 h->addChannel(c);
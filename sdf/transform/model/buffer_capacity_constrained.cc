@@ -35,7 +35,7 @@
  */
 
 #include "buffersize.h"
-#include "autoconc.h"
+#include "overlay.h"
 #include "../../base/hsdf/check.h"
 #include "../../analysis/mcm/mcm.h"
 namespace SDF
@@ -51,7 +51,7 @@ namespace SDF
      */
     TimedSDFgraph *createCapacityConstrainedModel(TimedSDFgraph *g)
     {
-        TimedSDFgraph *gNoConcurrency, *gConstrained;
+        TimedSDFgraph *gConstrained;
         CDouble mcm;
         CFraction mcmf;
 
@@ -60,10 +60,12 @@ namespace SDF
             throw CException("Graph is not an HSDF graph.");
 
         // Exclude auto-concurrency
-        gNoConcurrency = (TimedSDFgraph *)modelAutoConcurrencyInSDFgraph(g, 1);
+        TimedSDFgraphOverlay overlay(g);
+        overlay.modelAutoConcurrency(1);
 
         // Compute maximal throughput and MCM
-        mcm = maximumCycleMeanCycles(gNoConcurrency);
+        mcm = maximumCycleMeanCycles(overlay.getGraph());
+        overlay.restore();
         /// @todo
         /// what is a reasonable precision value?
         /// is lowestTerm necessary after doubleToFraction?
@@ -110,9 +112,6 @@ namespace SDF
             gConstrained->createChannel(aConstrained, 1, aMCM, 1, 0);
         }
 
-        // Cleanup
-        delete gNoConcurrency;
-
         return gConstrained;
     }
 
@@ -0,0 +1,277 @@
+/*
+ *  TU Eindhoven
+ *  Eindhoven, The Netherlands
+ *
+ *  Name            :   overlay.cc
+ *
+ *  Author          :   agent (agent@local)
+ *
+ *  Date            :   October 19, 2026
+ *
+ *  Function        :   Overlay of model transformations on a timed SDF graph
+ *
+ *  History         :
+ *      19-10-26    :   Initial version.
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, 59 Temple Place - Suite 330, Boston, MA 02111-1307, USA.
+ *
+ * In other words, you are welcome to use, share and improve this program.
+ * You are forbidden to forbid anyone else to use, share and improve
+ * what you give them.   Happy coding!
+ */
+
+
+#include "overlay.h"
+namespace SDF
+{
+    /**
+     * apply ()
+     * The function sets the cached artifacts of the original graph aside
+     * before the graph is modified for the first time.
+     */
+    void TimedSDFgraphOverlay::apply()
+    {
+        if (!applied)
+        {
+            graph->getCache().save(savedCache);
+            applied = true;
+        }
+    }
+
+    /**
+     * addChannel ()
+     * The function adds a channel between the source and destination actor.
+     * Ports with the supplied rates are added to these actors.
+     */
+    TimedSDFchannel *TimedSDFgraphOverlay::addChannel(SDFactor *src,
+            SDFrate rateSrc, SDFactor *dst, SDFrate rateDst, uint initialTokens)
+    {
+        TimedSDFchannel *c;
+
+        apply();
+        c = graph->createChannel(src, rateSrc, dst, rateDst, initialTokens);
+        addedChannels.push_back(c);
+
+        return c;
+    }
+
+    /**
+     * setInitialTokens ()
+     * The function changes the number of initial tokens on the channel.
+     */
+    void TimedSDFgraphOverlay::setInitialTokens(SDFchannel *c,
+            const uint tokens)
+    {
+        apply();
+        initialTokens.push_back(std::make_pair(c, c->getInitialTokens()));
+        c->setInitialTokens(tokens);
+    }
+
+    /**
+     * setBufferSize ()
+     * The function changes the buffer size of the channel.
+     */
+    void TimedSDFgraphOverlay::setBufferSize(TimedSDFchannel *c,
+            const TimedSDFchannel::BufferSize &sz)
+    {
+        apply();
+        bufferSizes.push_back(std::make_pair(c, c->getBufferSize()));
+        c->setBufferSize(sz);
+    }
+
+    /**
+     * setDefaultProcessor ()
+     * The function changes the default processor of the actor.
+     */
+    void TimedSDFgraphOverlay::setDefaultProcessor(TimedSDFactor *a,
+            const CString &proc)
+    {
+        apply();
+        defaultProcessors.push_back(std::make_pair(a,
+                                    a->getDefaultProcessor()));
+        a->setDefaultProcessor(proc);
+    }
+
+    /**
+     * modelAutoConcurrency ()
+     * The function limits the auto-concurrency of all actors to maxDegree
+     * through self-edges (see modelAutoConcurrencyInSDFgraph).
+     */
+    void TimedSDFgraphOverlay::modelAutoConcurrency(const uint maxDegree)
+    {
+        for (SDFactorsIter iter = graph->actorsBegin();
+             iter != graph->actorsEnd(); iter++)
+        {
+            SDFactor *a = *iter;
+
+            addChannel(a, 1, a, 1, maxDegree);
+        }
+    }
+
+    /**
+     * modelBufferSize ()
+     * The function models the size of all bounded channels through explicit
+     * channels. All buffer sizes are set to unbounded (see
+     * modelBufferSizeInSDFgraph).
+     */
+    void TimedSDFgraphOverlay::modelBufferSize()
+    {
+        SDFactor *srcActor, *dstActor;
+        SDFport *srcPort, *dstPort;
+        TimedSDFchannel *cN;
+        SDFport *srcPortN, *dstPortN;
+        TimedSDFchannel::BufferSize unboundedBuffer;
+        SDFcomponent comp;
+
+        apply();
+
+        // Unbounded buffer size
+        unboundedBuffer.sz = -1;
+        unboundedBuffer.mem = -1;
+        unboundedBuffer.src = -1;
+        unboundedBuffer.dst = -1;
+
+        // Iterate over all channels in the graph
+        for (SDFchannelsIter iter = graph->channelsBegin();
+             iter != graph->channelsEnd(); iter++)
+        {
+            TimedSDFchannel *c = (TimedSDFchannel *)(*iter);
+
+            // Source and destination actor and port of channel
+            srcActor = c->getSrcActor();
+            srcPort = c->getSrcPort();
+            dstActor = c->getDstActor();
+            dstPort = c->getDstPort();
+
+            // Is channel bounded?
+            if (!c->isUnbounded())
+            {
+                // Create a backward channel to model buffer size
+                comp = SDFcomponent(graph, graph->nrChannels());
+                cN = c->create(comp);
+                cN->setName(CString("_") + c->getName() + CString("b"));
+
+                // Initial tokens on channel to model buffer size of channel c
+                cN->setInitialTokens((c->getBufferSize().sz)
+                                     - c->getInitialTokens());
+
+                // Set channels to be unbounded
+                setBufferSize(c, unboundedBuffer);
+                cN->setBufferSize(unboundedBuffer);
+
+                // Create new ports on the source and destination actors
+                comp = SDFcomponent(dstActor, dstActor->nrPorts());
+                srcPortN = dstPort->create(comp);
+                srcPortN->setName(CString("_p") + CString(dstActor->nrPorts() + 1));
+                srcPortN->setType("out");
+                srcPortN->setRate(dstPort->getRate());
+                dstActor->addPort(srcPortN);
+
+                comp = SDFcomponent(srcActor, srcActor->nrPorts());
+                dstPortN = srcPort->create(comp);
+                dstPortN->setName(CString("_p") + CString(srcActor->nrPorts() + 1));
+                dstPortN->setType("in");
+                dstPortN->setRate(srcPort->getRate());
+                srcActor->addPort(dstPortN);
+
+                // Connect ports to channel
+                cN->connectSrc(srcPortN);
+                cN->connectDst(dstPortN);
+
+                // Create relation between buffer channel and channel c
+                cN->setStorageSpaceChannel(c);
+
+                // Add new channel to the graph
+                graph->addChannel(cN);
+                addedChannels.push_back(cN);
+            }
+        }
+    }
+
+    /**
+     * selectFastestProcessors ()
+     * The function makes the processor with the lowest execution time the
+     * default processor of every actor.
+     */
+    void TimedSDFgraphOverlay::selectFastestProcessors()
+    {
+        for (SDFactorsIter iter = graph->actorsBegin();
+             iter != graph->actorsEnd(); iter++)
+        {
+            TimedSDFactor *a = (TimedSDFactor *)*iter;
+            TimedSDFactor::Processor *proc = NULL;
+
+            for (TimedSDFactor::ProcessorsIter iterP = a->processorsBegin();
+                 iterP != a->processorsEnd(); iterP++)
+            {
+                TimedSDFactor::Processor *p = *iterP;
+
+                if (proc == NULL || proc->execTime > p->execTime)
+                    proc = p;
+            }
+
+            if (proc != NULL)
+                setDefaultProcessor(a, proc->type);
+        }
+    }
+
+    /**
+     * restore ()
+     * The function undoes all modifications in reverse order. The graph is
+     * left in its original state with the cached artifacts it had before the
+     * first modification.
+     */
+    void TimedSDFgraphOverlay::restore()
+    {
+        // Default processors, buffer sizes and initial tokens
+        while (!defaultProcessors.empty())
+        {
+            defaultProcessors.back().first->setDefaultProcessor(
+                defaultProcessors.back().second);
+            defaultProcessors.pop_back();
+        }
+
+        while (!bufferSizes.empty())
+        {
+            bufferSizes.back().first->setBufferSize(bufferSizes.back().second);
+            bufferSizes.pop_back();
+        }
+
+        while (!initialTokens.empty())
+        {
+            initialTokens.back().first->setInitialTokens(
+                initialTokens.back().second);
+            initialTokens.pop_back();
+        }
+
+        // Channels and their ports
+        while (!addedChannels.empty())
+        {
+            SDFchannel *c = addedChannels.back();
+
+            c->getSrcActor()->removePort(c->getSrcPort());
+            c->getDstActor()->removePort(c->getDstPort());
+            graph->removeChannel(c);
+            addedChannels.pop_back();
+        }
+
+        // Cache of the original graph
+        if (applied)
+        {
+            graph->getCache().restore(savedCache);
+            applied = false;
+        }
+    }
+
+}//namespace SDF
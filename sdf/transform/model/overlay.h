@@ -0,0 +1,117 @@
+/*
+ *  TU Eindhoven
+ *  Eindhoven, The Netherlands
+ *
+ *  Name            :   overlay.h
+ *
+ *  Author          :   agent (agent@local)
+ *
+ *  Date            :   October 19, 2026
+ *
+ *  Function        :   Overlay of model transformations on a timed SDF graph
+ *
+ *  History         :
+ *      19-10-26    :   Initial version.
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, 59 Temple Place - Suite 330, Boston, MA 02111-1307, USA.
+ *
+ * In other words, you are welcome to use, share and improve this program.
+ * You are forbidden to forbid anyone else to use, share and improve
+ * what you give them.   Happy coding!
+ */
+
+
+#ifndef SDF_TRANSFORM_MODEL_OVERLAY_H_INCLUDED
+#define SDF_TRANSFORM_MODEL_OVERLAY_H_INCLUDED
+
+#include "../../base/timed/graph.h"
+namespace SDF
+{
+    /**
+     * TimedSDFgraphOverlay
+     * A set of modifications (added channels, changed initial tokens, buffer
+     * sizes and default processors) applied to a timed SDF graph without
+     * copying its actors, ports and channels. The overlay is no view on the
+     * graph: the modifications are made in place and can be undone. While the
+     * overlay is applied, every user of the graph sees the modified model
+     * through its normal interface. The graph must therefore not be used by
+     * other threads or be modified otherwise in the meantime. All
+     * modifications are undone when the overlay is restored or destroyed. The
+     * artifacts which were cached for the original graph are set aside while
+     * the overlay is applied and are valid again after the restore. The
+     * overlay is a cheap alternative for the model transformations which
+     * create a modified clone of a graph.
+     */
+    class TimedSDFgraphOverlay
+    {
+        public:
+            // Constructor
+            TimedSDFgraphOverlay(TimedSDFgraph *g)
+            {
+                graph = g;
+                applied = false;
+            };
+
+            // Destructor
+            ~TimedSDFgraphOverlay()
+            {
+                restore();
+            };
+
+            // Graph presenting the modified model
+            TimedSDFgraph *getGraph() const
+            {
+                return graph;
+            };
+
+            // Modifications
+            TimedSDFchannel *addChannel(SDFactor *src, SDFrate rateSrc,
+                                        SDFactor *dst, SDFrate rateDst, uint initialTokens);
+            void setInitialTokens(SDFchannel *c, const uint tokens);
+            void setBufferSize(TimedSDFchannel *c,
+                               const TimedSDFchannel::BufferSize &sz);
+            void setDefaultProcessor(TimedSDFactor *a, const CString &proc);
+
+            // Model transformations
+            void modelAutoConcurrency(const uint maxDegree);
+            void modelBufferSize();
+            void selectFastestProcessors();
+
+            // Undo all modifications
+            void restore();
+
+        private:
+            // Set the cache of the original graph aside before the first
+            // modification
+            void apply();
+
+            // Graph
+            TimedSDFgraph *graph;
+
+            // Modifications are applied to the graph and the cache of the
+            // original graph
+            bool applied;
+            SDFgraphCache savedCache;
+
+            // Added channels and original values of modified properties (in
+            // order of modification)
+            vector<SDFchannel *> addedChannels;
+            vector< std::pair<SDFchannel *, uint> > initialTokens;
+            vector< std::pair<TimedSDFchannel *, TimedSDFchannel::BufferSize> >
+            bufferSizes;
+            vector< std::pair<TimedSDFactor *, CString> > defaultProcessors;
+    };
+
+}//namespace SDF
+#endif
@@ -40,18 +40,86 @@ namespace SDF
 {
 
 
+    /**
+     * transformUnfoldedHSDFtoAPG ()
+     * The function constructs the ayclic precendence graph of the HSDF graph
+     * unfolded blockingFactor times without constructing the unfolded graph.
+     * Copy i of the actor at position x in the HSDF graph has id
+     * x * blockingFactor + i in the unfolded graph and copy l of the channel at
+     * position y has id y * blockingFactor + l (see unfoldHSDF). A copy of a
+     * channel with d initial tokens has no tokens when d < blockingFactor and
+     * l >= d. It connects copy l - d of the source to copy l of the
+     * destination.
+     */
+    static
+    APGgraph *transformUnfoldedHSDFtoAPG(TimedSDFgraph *hsdf,
+                                         const uint blockingFactor)
+    {
+        const uint N = blockingFactor;
+        vector<APGnode *> nodes;
+        v_uint actorIndex;
+        uint x = 0, y = 0;
+
+        if (N == 0)
+            throw CException("Unfolding factor must be positive.");
+
+        // Construct new graph
+        APGgraph *g = new APGgraph(hsdf->getId());
+
+        // Create a node for each copy of each actor
+        for (SDFactorsIter iter = hsdf->actorsBegin();
+             iter != hsdf->actorsEnd(); iter++, x++)
+        {
+            TimedSDFactor *a = (TimedSDFactor *)(*iter);
+
+            if (a->getId() >= actorIndex.size())
+                actorIndex.resize(a->getId() + 1);
+            actorIndex[a->getId()] = x;
+
+            for (uint i = 0; i < N; i++)
+            {
+                APGnode *n = g->newNode(x * N + i);
+
+                n->setWeight(a->getExecutionTime());
+                nodes.push_back(n);
+            }
+        }
+
+        // Create edges between the nodes for each copy of a channel with no
+        // tokens
+        for (SDFchannelsIter iter = hsdf->channelsBegin();
+             iter != hsdf->channelsEnd(); iter++, y++)
+        {
+            SDFchannel *c = *iter;
+            uint d = c->getInitialTokens();
+            uint src = actorIndex[c->getSrcActor()->getId()] * N;
+            uint dst = actorIndex[c->getDstActor()->getId()] * N;
+
+            for (uint l = d; l < N; l++)
+                g->newEdge(y * N + l, nodes[src + l - d], nodes[dst + l]);
+        }
+
+        return g;
+    }
+
     /**
      * transformHSDFtoAPG ()
      * The function transforms an HSDF graph to an ayclic precendence graph.
      * The 'id' of the nodes in the APG corresponds to the 'id' of the actors in
-     * the HSDF graph.
+     * the HSDF graph. By default, the APG of the unfolded graph is constructed
+     * directly. When direct is false, the unfolded HSDF graph is constructed
+     * first.
      */
-    APGgraph *transformHSDFtoAPG(TimedSDFgraph *hsdf, const uint blockingFactor)
+    APGgraph *transformHSDFtoAPG(TimedSDFgraph *hsdf, const uint blockingFactor,
+                                 const bool direct)
     {
         // Check SDF graph
         if (!isHSDFgraph(hsdf))
             throw CException("SDF graph is not a HSDF graph.");
 
+        if (direct)
+            return transformUnfoldedHSDFtoAPG(hsdf, blockingFactor);
+
         // Unfold HSDF with blocking factor
         TimedSDFgraph *h = (TimedSDFgraph *)unfoldHSDF(hsdf, blockingFactor);
 
@@ -46,9 +46,12 @@ namespace SDF
      * transformHSDFtoAPG ()
      * The function transforms an HSDF graph to an ayclic precendence graph.
      * The 'id' of the nodes in the APG corresponds to the 'id' of the actors in
-     * the HSDF graph.
+     * the HSDF graph. By default, the APG of the unfolded graph is constructed
+     * directly. When direct is false, the unfolded HSDF graph is constructed
+     * first.
      */
-    APGgraph *transformHSDFtoAPG(TimedSDFgraph *hsdf, const uint blockingFactor);
+    APGgraph *transformHSDFtoAPG(TimedSDFgraph *hsdf, const uint blockingFactor,
+                                 const bool direct = true);
 
 }//namespace SDF
 #endif